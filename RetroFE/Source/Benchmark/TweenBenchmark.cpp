@@ -0,0 +1,187 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Compares TweenSet::animate with the per tween property switch that
+// Component::animate used before tween sets were evaluated in batches.
+// Built when RETROFE_BUILD_BENCHMARKS is on; run with optional frame and
+// component counts.
+
+#include "../Graphics/Animate/TweenSet.h"
+#include "../Graphics/ViewInfo.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static float animateTween(Tween *tween, double elapsedTime, float start)
+{
+    if (tween->startDefined)
+        return tween->animate(elapsedTime);
+    else
+        return tween->animate(elapsedTime, start);
+}
+
+// The previous Component::animate loop
+static bool animatePerTween(TweenSet *tweens, double elapsedTweenTime, ViewInfo &view, ViewInfo &store)
+{
+    bool currentDone = true;
+
+    for(unsigned int i = 0; i < tweens->size(); i++)
+    {
+        Tween *tween = tweens->tweens()->at(i);
+        double elapsedTime = elapsedTweenTime;
+
+        if ( elapsedTime < tween->duration )
+            currentDone = false;
+        else
+            elapsedTime = static_cast<float>(tween->duration);
+
+        switch(tween->property)
+        {
+        case TWEEN_PROPERTY_X:                view.X               = animateTween(tween, elapsedTime, store.X); break;
+        case TWEEN_PROPERTY_Y:                view.Y               = animateTween(tween, elapsedTime, store.Y); break;
+        case TWEEN_PROPERTY_HEIGHT:           view.Height          = animateTween(tween, elapsedTime, store.Height); break;
+        case TWEEN_PROPERTY_WIDTH:            view.Width           = animateTween(tween, elapsedTime, store.Width); break;
+        case TWEEN_PROPERTY_ANGLE:            view.Angle           = animateTween(tween, elapsedTime, store.Angle); break;
+        case TWEEN_PROPERTY_ALPHA:            view.Alpha           = animateTween(tween, elapsedTime, store.Alpha); break;
+        case TWEEN_PROPERTY_X_ORIGIN:         view.XOrigin         = animateTween(tween, elapsedTime, store.XOrigin); break;
+        case TWEEN_PROPERTY_Y_ORIGIN:         view.YOrigin         = animateTween(tween, elapsedTime, store.YOrigin); break;
+        case TWEEN_PROPERTY_X_OFFSET:         view.XOffset         = animateTween(tween, elapsedTime, store.XOffset); break;
+        case TWEEN_PROPERTY_Y_OFFSET:         view.YOffset         = animateTween(tween, elapsedTime, store.YOffset); break;
+        case TWEEN_PROPERTY_FONT_SIZE:        view.FontSize        = animateTween(tween, elapsedTime, store.FontSize); break;
+        case TWEEN_PROPERTY_BACKGROUND_ALPHA: view.BackgroundAlpha = animateTween(tween, elapsedTime, store.BackgroundAlpha); break;
+        case TWEEN_PROPERTY_MAX_WIDTH:        view.MaxWidth        = animateTween(tween, elapsedTime, store.MaxWidth); break;
+        case TWEEN_PROPERTY_MAX_HEIGHT:       view.MaxHeight       = animateTween(tween, elapsedTime, store.MaxHeight); break;
+        case TWEEN_PROPERTY_LAYER:            view.Layer           = static_cast<unsigned int>(animateTween(tween, elapsedTime, static_cast<float>(store.Layer))); break;
+        case TWEEN_PROPERTY_CONTAINER_X:      view.ContainerX      = animateTween(tween, elapsedTime, store.ContainerX); break;
+        case TWEEN_PROPERTY_CONTAINER_Y:      view.ContainerY      = animateTween(tween, elapsedTime, store.ContainerY); break;
+        case TWEEN_PROPERTY_CONTAINER_WIDTH:  view.ContainerWidth  = animateTween(tween, elapsedTime, store.ContainerWidth); break;
+        case TWEEN_PROPERTY_CONTAINER_HEIGHT: view.ContainerHeight = animateTween(tween, elapsedTime, store.ContainerHeight); break;
+        case TWEEN_PROPERTY_VOLUME:           view.Volume          = animateTween(tween, elapsedTime, store.Volume); break;
+        case TWEEN_PROPERTY_MONITOR:          view.Monitor         = static_cast<unsigned int>(animateTween(tween, elapsedTime, static_cast<float>(store.Monitor))); break;
+        case TWEEN_PROPERTY_NOP:
+            break;
+        }
+    }
+
+    return currentDone;
+}
+
+
+static bool sameView(ViewInfo &a, ViewInfo &b)
+{
+    return a.X == b.X && a.Y == b.Y && a.Height == b.Height && a.Width == b.Width &&
+           a.Angle == b.Angle && a.Alpha == b.Alpha && a.XOrigin == b.XOrigin &&
+           a.YOrigin == b.YOrigin && a.XOffset == b.XOffset && a.YOffset == b.YOffset &&
+           a.FontSize == b.FontSize && a.BackgroundAlpha == b.BackgroundAlpha &&
+           a.MaxWidth == b.MaxWidth && a.MaxHeight == b.MaxHeight && a.Layer == b.Layer &&
+           a.Volume == b.Volume && a.Monitor == b.Monitor;
+}
+
+
+int main(int argc, char **argv)
+{
+    int frames     = (argc > 1) ? atoi(argv[1]) : 200000;
+    int components = (argc > 2) ? atoi(argv[2]) : 30;
+    if (frames <= 0 || components <= 0)
+    {
+        printf("usage: %s [frames] [components]\n", argv[0]);
+        return 1;
+    }
+
+    // Every component tweens the same properties a typical layout animates;
+    // a third of them ease, the rest are linear, and one property takes its
+    // start value from the stored view
+    const TweenProperty properties[] =
+    {
+        TWEEN_PROPERTY_HEIGHT, TWEEN_PROPERTY_WIDTH, TWEEN_PROPERTY_ANGLE, TWEEN_PROPERTY_ALPHA,
+        TWEEN_PROPERTY_X, TWEEN_PROPERTY_Y, TWEEN_PROPERTY_X_ORIGIN, TWEEN_PROPERTY_Y_ORIGIN,
+        TWEEN_PROPERTY_X_OFFSET, TWEEN_PROPERTY_Y_OFFSET, TWEEN_PROPERTY_FONT_SIZE,
+        TWEEN_PROPERTY_BACKGROUND_ALPHA, TWEEN_PROPERTY_MAX_WIDTH, TWEEN_PROPERTY_MAX_HEIGHT,
+        TWEEN_PROPERTY_LAYER, TWEEN_PROPERTY_VOLUME, TWEEN_PROPERTY_MONITOR
+    };
+    const unsigned int numProperties = sizeof(properties) / sizeof(properties[0]);
+
+    std::vector<TweenSet *> sets;
+    std::vector<ViewInfo>   views(components);
+    std::vector<ViewInfo>   batchViews(components);
+    std::vector<ViewInfo>   stores(components);
+    for (int c = 0; c < components; c++)
+    {
+        TweenSet *set = new TweenSet();
+        for (unsigned int i = 0; i < numProperties; i++)
+        {
+            Tween *tween = new Tween(properties[i], (c % 3 == 0) ? EASE_OUT_CUBIC : LINEAR, i, i + 100, 0.5);
+            tween->startDefined = (properties[i] != TWEEN_PROPERTY_X);
+            set->push(tween);
+        }
+        stores[c].X = static_cast<float>(c);
+        sets.push_back(set);
+    }
+
+    // Both paths have to agree before their times mean anything
+    for (int f = 0; f < 100; f++)
+    {
+        for (int c = 0; c < components; c++)
+        {
+            animatePerTween(sets[c], f * 0.006, views[c], stores[c]);
+            sets[c]->animate(f * 0.006, batchViews[c], stores[c]);
+            if (!sameView(views[c], batchViews[c]))
+            {
+                printf("results differ at frame %d, component %d\n", f, c);
+                return 1;
+            }
+        }
+    }
+
+    double perTweenSum = 0;
+    double batchedSum  = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++)
+    {
+        for (int c = 0; c < components; c++)
+        {
+            animatePerTween(sets[c], (f % 100) * 0.006, views[c], stores[c]);
+            perTweenSum += views[c].X;
+        }
+    }
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++)
+    {
+        for (int c = 0; c < components; c++)
+        {
+            sets[c]->animate((f % 100) * 0.006, batchViews[c], stores[c]);
+            batchedSum += batchViews[c].X;
+        }
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    double perTween = std::chrono::duration<double, std::milli>(middle - start).count();
+    double batched  = std::chrono::duration<double, std::milli>(end - middle).count();
+    printf("%d frames, %d components, %u tweens each\n", frames, components, numProperties);
+    printf("per tween: %.1f ms\n", perTween);
+    printf("batched:   %.1f ms (%.2fx)\n", batched, perTween / batched);
+
+    for (unsigned int i = 0; i < sets.size(); i++)
+    {
+        delete sets[i];
+    }
+
+    // The sums keep the loops from being optimized away; both paths add up
+    // the same values in the same order
+    return (perTweenSum == batchedSum) ? 0 : 1;
+}
@@ -0,0 +1,648 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MameListParser.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+static const int NO_CHAR = -2;
+
+static bool isSpace(int c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static void appendUtf8(std::string &text, unsigned long code)
+{
+    if(code < 0x80)
+    {
+        text.push_back(static_cast<char>(code));
+    }
+    else if(code < 0x800)
+    {
+        text.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    else if(code < 0x10000)
+    {
+        text.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        text.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    else if(code < 0x110000)
+    {
+        text.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        text.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+
+MameListParser::MameListParser(std::string filename)
+    : filename_(filename)
+    , buffer_(BUFFER_SIZE)
+    , pos_(0)
+    , end_(0)
+    , line_(1)
+    , pushedBack_(NO_CHAR)
+    , selfClosing_(false)
+    , done_(false)
+{
+}
+
+MameListParser::~MameListParser()
+{
+}
+
+
+// Open the file and read up to the <mame> root element
+bool MameListParser::open()
+{
+    file_.open(filename_.c_str(), std::ios::in | std::ios::binary);
+    if(!file_.is_open())
+    {
+        setError("Could not open file");
+        return false;
+    }
+
+    if(readEvent(NULL) != EVENT_START || tagName_ != "mame")
+    {
+        setError("Does not appear to be a MameList file (missing <mame> tag)");
+        return false;
+    }
+    done_ = selfClosing_;
+
+    return true;
+}
+
+
+// Read the next machine. Returns false at the end of the list or when the
+// file could not be parsed; hasError() tells the two apart.
+bool MameListParser::next(Machine &machine)
+{
+    while(!done_)
+    {
+        Event event = readEvent(NULL);
+        if(event == EVENT_END)
+        {
+            done_ = true;
+            return false;
+        }
+        if(event != EVENT_START)
+        {
+            setError("Unexpected end of file");
+            return false;
+        }
+        if(tagName_ != "machine" && tagName_ != "game")
+        {
+            if(!selfClosing_ && !skipElement())
+            {
+                return false;
+            }
+            continue;
+        }
+
+        machine = Machine();
+        machine.name    = getAttribute("name");
+        machine.cloneOf = getAttribute("cloneof");
+
+        // Only the first of each element counts
+        bool hasDescription  = false;
+        bool hasYear         = false;
+        bool hasManufacturer = false;
+        bool hasGenre        = false;
+        bool hasInput        = false;
+
+        bool inMachine = !selfClosing_;
+        while(inMachine)
+        {
+            event = readEvent(NULL);
+            if(event == EVENT_END)
+            {
+                break;
+            }
+            if(event != EVENT_START)
+            {
+                setError("Unexpected end of file");
+                return false;
+            }
+
+            std::string *field = NULL;
+            if(tagName_ == "description" && !hasDescription)
+            {
+                field          = &machine.description;
+                hasDescription = true;
+            }
+            else if(tagName_ == "year" && !hasYear)
+            {
+                field   = &machine.year;
+                hasYear = true;
+            }
+            else if(tagName_ == "manufacturer" && !hasManufacturer)
+            {
+                field           = &machine.manufacturer;
+                hasManufacturer = true;
+            }
+            else if(tagName_ == "genre" && !hasGenre)
+            {
+                field    = &machine.genre;
+                hasGenre = true;
+            }
+            else if(tagName_ == "input" && !hasInput)
+            {
+                machine.players = getAttribute("players");
+                machine.buttons = getAttribute("buttons");
+                hasInput        = true;
+            }
+
+            if(!selfClosing_ && (field ? !readText(*field) : !skipElement()))
+            {
+                return false;
+            }
+        }
+
+        if(!hasDescription)
+        {
+            machine.description = machine.name;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+
+bool MameListParser::hasError()
+{
+    return !error_.empty();
+}
+
+
+std::string MameListParser::getError()
+{
+    return error_;
+}
+
+
+int MameListParser::get()
+{
+    int c;
+
+    if(pushedBack_ != NO_CHAR)
+    {
+        c           = pushedBack_;
+        pushedBack_ = NO_CHAR;
+    }
+    else
+    {
+        if(pos_ >= end_)
+        {
+            if(!file_.good())
+            {
+                return EOF;
+            }
+            file_.read(&buffer_[0], BUFFER_SIZE);
+            end_ = static_cast<int>(file_.gcount());
+            pos_ = 0;
+            if(end_ <= 0)
+            {
+                return EOF;
+            }
+        }
+        c = static_cast<unsigned char>(buffer_[pos_++]);
+    }
+
+    if(c == '\n')
+    {
+        line_++;
+    }
+    return c;
+}
+
+
+void MameListParser::unget(int c)
+{
+    if(c == '\n')
+    {
+        line_--;
+    }
+    pushedBack_ = c;
+}
+
+
+// Read up to the next start or end tag. Character data on the way is
+// appended to text, if given; comments, processing instructions and the
+// DOCTYPE are skipped.
+MameListParser::Event MameListParser::readEvent(std::string *text)
+{
+    for(;;)
+    {
+        int c = get();
+        if(c == EOF)
+        {
+            return EVENT_EOF;
+        }
+        if(c == '&')
+        {
+            readEntity(text);
+            continue;
+        }
+        if(c != '<')
+        {
+            if(text)
+            {
+                text->push_back(static_cast<char>(c));
+            }
+            continue;
+        }
+
+        c = get();
+        if(c == '?')
+        {
+            if(!skipPast("?>", NULL))
+            {
+                return EVENT_ERROR;
+            }
+        }
+        else if(c == '!')
+        {
+            c = get();
+            if(c == '-')
+            {
+                if(get() != '-')
+                {
+                    setError("Malformed comment");
+                    return EVENT_ERROR;
+                }
+                if(!skipPast("-->", NULL))
+                {
+                    return EVENT_ERROR;
+                }
+            }
+            else if(c == '[')
+            {
+                for(const char *p = "CDATA["; *p; ++p)
+                {
+                    if(get() != *p)
+                    {
+                        setError("Malformed CDATA section");
+                        return EVENT_ERROR;
+                    }
+                }
+                if(!skipPast("]]>", text))
+                {
+                    return EVENT_ERROR;
+                }
+            }
+            else if(!skipDeclaration())
+            {
+                return EVENT_ERROR;
+            }
+        }
+        else if(c == '/')
+        {
+            c = get();
+            if(!readName(c, tagName_))
+            {
+                return EVENT_ERROR;
+            }
+            while(isSpace(c))
+            {
+                c = get();
+            }
+            if(c != '>')
+            {
+                setError("Malformed end tag </" + tagName_ + ">");
+                return EVENT_ERROR;
+            }
+            return EVENT_END;
+        }
+        else
+        {
+            if(!readName(c, tagName_) || tagName_.empty() || !readAttributes(c))
+            {
+                setError("Malformed start tag <" + tagName_ + ">");
+                return EVENT_ERROR;
+            }
+            return EVENT_START;
+        }
+    }
+}
+
+
+// Read a tag or attribute name starting with c; c is left at the first
+// character after the name
+bool MameListParser::readName(int &c, std::string &name)
+{
+    name.clear();
+    while(c != EOF && !isSpace(c) && c != '/' && c != '>' && c != '=')
+    {
+        name.push_back(static_cast<char>(c));
+        c = get();
+    }
+    if(c == EOF)
+    {
+        setError("Unexpected end of file");
+        return false;
+    }
+    return true;
+}
+
+
+bool MameListParser::readAttributes(int c)
+{
+    attributes_.clear();
+    selfClosing_ = false;
+
+    for(;;)
+    {
+        while(isSpace(c))
+        {
+            c = get();
+        }
+        if(c == '>')
+        {
+            return true;
+        }
+        if(c == '/')
+        {
+            selfClosing_ = true;
+            return get() == '>';
+        }
+
+        std::pair<std::string, std::string> attribute;
+        if(!readName(c, attribute.first) || attribute.first.empty())
+        {
+            return false;
+        }
+        while(isSpace(c))
+        {
+            c = get();
+        }
+        if(c != '=')
+        {
+            return false;
+        }
+        c = get();
+        while(isSpace(c))
+        {
+            c = get();
+        }
+        if(c != '"' && c != '\'')
+        {
+            return false;
+        }
+
+        int quote = c;
+        for(c = get(); c != quote; c = get())
+        {
+            if(c == EOF)
+            {
+                return false;
+            }
+            if(c == '&')
+            {
+                readEntity(&attribute.second);
+            }
+            else
+            {
+                attribute.second.push_back(static_cast<char>(c));
+            }
+        }
+        attributes_.push_back(attribute);
+        c = get();
+    }
+}
+
+
+// Decode the entity following a '&'. Unknown entities are kept as they are.
+void MameListParser::readEntity(std::string *text)
+{
+    std::string entity;
+    int c = get();
+    while(c == '#' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+    {
+        entity.push_back(static_cast<char>(c));
+        c = get();
+    }
+    if(c != ';')
+    {
+        // not an entity; leave the character that ended it to the caller
+        if(c != EOF)
+        {
+            unget(c);
+        }
+        if(text)
+        {
+            text->append("&" + entity);
+        }
+        return;
+    }
+    if(!text)
+    {
+        return;
+    }
+
+    if(entity == "amp")
+    {
+        text->push_back('&');
+    }
+    else if(entity == "lt")
+    {
+        text->push_back('<');
+    }
+    else if(entity == "gt")
+    {
+        text->push_back('>');
+    }
+    else if(entity == "quot")
+    {
+        text->push_back('"');
+    }
+    else if(entity == "apos")
+    {
+        text->push_back('\'');
+    }
+    else if(entity.size() > 1 && entity[0] == '#')
+    {
+        unsigned long code;
+        if(entity[1] == 'x' || entity[1] == 'X')
+        {
+            code = strtoul(entity.c_str() + 2, NULL, 16);
+        }
+        else
+        {
+            code = strtoul(entity.c_str() + 1, NULL, 10);
+        }
+        appendUtf8(*text, code);
+    }
+    else
+    {
+        text->append("&" + entity + ";");
+    }
+}
+
+
+// Skip to just after terminator, appending what comes before it to text
+bool MameListParser::skipPast(const char *terminator, std::string *text)
+{
+    size_t length = strlen(terminator);
+    std::string tail;
+
+    while(tail != terminator)
+    {
+        int c = get();
+        if(c == EOF)
+        {
+            setError("Unexpected end of file");
+            return false;
+        }
+        tail.push_back(static_cast<char>(c));
+        if(tail.size() > length)
+        {
+            if(text)
+            {
+                text->push_back(tail[0]);
+            }
+            tail.erase(0, 1);
+        }
+    }
+
+    return true;
+}
+
+
+// Skip a <!DOCTYPE ...> declaration, including its internal subset
+bool MameListParser::skipDeclaration()
+{
+    int depth = 0;
+    int quote = 0;
+    int c;
+
+    while((c = get()) != EOF)
+    {
+        if(quote)
+        {
+            if(c == quote)
+            {
+                quote = 0;
+            }
+        }
+        else if(c == '"' || c == '\'')
+        {
+            quote = c;
+        }
+        else if(c == '[')
+        {
+            depth++;
+        }
+        else if(c == ']')
+        {
+            depth--;
+        }
+        else if(c == '>' && depth <= 0)
+        {
+            return true;
+        }
+    }
+
+    setError("Unexpected end of file");
+    return false;
+}
+
+
+// Skip the rest of the element whose start tag was just read
+bool MameListParser::skipElement()
+{
+    int depth = 1;
+
+    while(depth > 0)
+    {
+        Event event = readEvent(NULL);
+        if(event == EVENT_START)
+        {
+            if(!selfClosing_)
+            {
+                depth++;
+            }
+        }
+        else if(event == EVENT_END)
+        {
+            depth--;
+        }
+        else
+        {
+            setError("Unexpected end of file");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// Read the character data of the element whose start tag was just read
+bool MameListParser::readText(std::string &text)
+{
+    text.clear();
+
+    for(;;)
+    {
+        Event event = readEvent(&text);
+        if(event == EVENT_END)
+        {
+            return true;
+        }
+        if(event != EVENT_START)
+        {
+            setError("Unexpected end of file");
+            return false;
+        }
+        if(!selfClosing_ && !skipElement())
+        {
+            return false;
+        }
+    }
+}
+
+
+std::string MameListParser::getAttribute(const char *name)
+{
+    for(unsigned int i = 0; i < attributes_.size(); ++i)
+    {
+        if(attributes_[i].first == name)
+        {
+            return attributes_[i].second;
+        }
+    }
+    return "";
+}
+
+
+// Keep the first error, with the line it was found on
+void MameListParser::setError(std::string error)
+{
+    if(error_.empty())
+    {
+        std::stringstream ss;
+        ss << error << " [Line: " << line_ << "]";
+        error_ = ss.str();
+    }
+}
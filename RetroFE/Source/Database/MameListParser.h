@@ -0,0 +1,85 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <utility>
+
+// Reads a MAME -listxml file one <machine> (or <game>) element at a time,
+// so memory use does not grow with the size of the file. Only the elements
+// the metadata import uses are looked at; roms, chips, displays and the
+// like are skipped over without being stored.
+class MameListParser
+{
+public:
+    struct Machine
+    {
+        std::string name;
+        std::string description;
+        std::string year;
+        std::string manufacturer;
+        std::string genre;
+        std::string cloneOf;
+        std::string players;
+        std::string buttons;
+    };
+
+    MameListParser(std::string filename);
+    virtual ~MameListParser();
+    bool open();
+    bool next(Machine &machine);
+    bool hasError();
+    std::string getError();
+
+private:
+    enum Event
+    {
+        EVENT_START,
+        EVENT_END,
+        EVENT_EOF,
+        EVENT_ERROR
+    };
+
+    int get();
+    void unget(int c);
+    Event readEvent(std::string *text);
+    bool readName(int &c, std::string &name);
+    bool readAttributes(int c);
+    void readEntity(std::string *text);
+    bool skipPast(const char *terminator, std::string *text);
+    bool skipDeclaration();
+    bool skipElement();
+    bool readText(std::string &text);
+    std::string getAttribute(const char *name);
+    void setError(std::string error);
+
+    static const int BUFFER_SIZE = 65536;
+
+    std::string filename_;
+    std::ifstream file_;
+    std::vector<char> buffer_;
+    int pos_;
+    int end_;
+    int line_;
+    int pushedBack_;
+    std::string tagName_;
+    std::vector<std::pair<std::string, std::string> > attributes_;
+    bool selfClosing_;
+    bool done_;
+    std::string error_;
+};
@@ -20,6 +20,7 @@
 #include "../Utility/Utils.h"
 #include "Configuration.h"
 #include "DB.h"
+#include "MameListParser.h"
 #include <algorithm>
 #include <dirent.h>
 #include <fstream>
@@ -31,6 +32,7 @@
 #include <sys/types.h>
 #include <sqlite3.h>
 #include <zlib.h>
+#include <SDL2/SDL.h>
 #include <exception>
 
 #if defined(__linux) || defined(__APPLE__)
@@ -123,6 +125,8 @@ bool MetadataDatabase::importDirectory()
     std::string mameListPath   = Utils::combinePath(Configuration::absolutePath, "meta", "mamelist");
     std::string emuarcListPath = Utils::combinePath(Configuration::absolutePath, "meta", "emuarc");
 
+    beginImport();
+
     dp = opendir(hyperListPath.c_str());
 
     if(dp == NULL)
@@ -219,9 +223,55 @@ bool MetadataDatabase::importDirectory()
         if (dp) closedir(dp);
     }
 
+    endImport();
+
     return true;
 }
 
+
+// Bulk loads run without waiting for each write to reach the disk and with
+// a larger page cache. The rollback journal stays on disk, so a crash of
+// RetroFE during an import rolls back cleanly; only an OS crash or power
+// loss while the import is writing can leave meta.db damaged.
+void MetadataDatabase::beginImport()
+{
+    char *error = NULL;
+
+    if(sqlite3_exec(db_.handle, "PRAGMA synchronous = OFF; PRAGMA cache_size = -65536;", NULL, NULL, &error) != SQLITE_OK)
+    {
+        std::string emsg = (error) ? error : "";
+        Logger::write(Logger::ZONE_WARNING, "Metadata", "Could not set the import pragmas: " + emsg);
+        sqlite3_free(error);
+    }
+}
+
+
+// Back to the SQLite defaults
+void MetadataDatabase::endImport()
+{
+    char *error = NULL;
+
+    if(sqlite3_exec(db_.handle, "PRAGMA synchronous = FULL; PRAGMA cache_size = -2000;", NULL, NULL, &error) != SQLITE_OK)
+    {
+        std::string emsg = (error) ? error : "";
+        Logger::write(Logger::ZONE_WARNING, "Metadata", "Could not reset the import pragmas: " + emsg);
+        sqlite3_free(error);
+    }
+}
+
+
+void MetadataDatabase::logImportRate(std::string filename, int rows, Uint32 startTime)
+{
+    Uint32 time = SDL_GetTicks() - startTime;
+    std::stringstream ss;
+    ss << "Imported " << rows << " rows from \"" << filename << "\" in " << time << " ms";
+    if(time > 0)
+    {
+        ss << " (" << static_cast<long>(rows * 1000.0 / time) << " rows/s)";
+    }
+    Logger::write(Logger::ZONE_INFO, "Metadata", ss.str());
+}
+
 void MetadataDatabase::injectMetadata(CollectionInfo *collection)
 {
     sqlite3 *handle = db_.handle;
@@ -333,6 +383,7 @@ bool MetadataDatabase::needsRefresh()
 bool MetadataDatabase::importHyperlist(std::string hyperlistFile, std::string collectionName)
 {
     char *error = NULL;
+    Uint32 startTime = SDL_GetTicks();
 
     config_.setProperty("status", "Scraping data from \"" + hyperlistFile + "\"");
     rapidxml::xml_document<> doc;
@@ -354,6 +405,17 @@ bool MetadataDatabase::importHyperlist(std::string hyperlistFile, std::string co
         }
         sqlite3 *handle = db_.handle;
         sqlite3_exec(handle, "BEGIN IMMEDIATE TRANSACTION;", NULL, NULL, &error);
+        sqlite3_stmt *stmt;
+        if(sqlite3_prepare_v2(handle,
+                              "INSERT OR REPLACE INTO Meta (name, title, year, manufacturer, developer, genre, players, ctrltype, buttons, joyways, cloneOf, collectionName, rating, score) VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?)",
+                              -1, &stmt, 0) != SQLITE_OK)
+        {
+            std::string emsg = sqlite3_errmsg(handle);
+            Logger::write(Logger::ZONE_ERROR, "Metadata", "SQL Error preparing the hyperlist insert: " + emsg);
+            sqlite3_exec(handle, "ROLLBACK TRANSACTION;", NULL, NULL, &error);
+            return false;
+        }
+        int rows = 0;
         for(rapidxml::xml_node<> *game = root->first_node("game"); game; game = game->next_sibling("game"))
         {
             rapidxml::xml_attribute<> *nameXml = game->first_attribute("name");
@@ -389,12 +451,6 @@ bool MetadataDatabase::importHyperlist(std::string hyperlistFile, std::string co
 
             if(name.length() > 0)
             {
-                sqlite3_stmt *stmt;
-
-                sqlite3_prepare_v2(handle,
-                                   "INSERT OR REPLACE INTO Meta (name, title, year, manufacturer, developer, genre, players, ctrltype, buttons, joyways, cloneOf, collectionName, rating, score) VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?)",
-                                   -1, &stmt, 0);
-
                 sqlite3_bind_text(stmt,  1, name.c_str(), -1, SQLITE_TRANSIENT);
                 sqlite3_bind_text(stmt,  2, description.c_str(), -1, SQLITE_TRANSIENT);
                 sqlite3_bind_text(stmt,  3, year.c_str(), -1, SQLITE_TRANSIENT);
@@ -411,11 +467,15 @@ bool MetadataDatabase::importHyperlist(std::string hyperlistFile, std::string co
                 sqlite3_bind_text(stmt, 14, score.c_str(), -1, SQLITE_TRANSIENT);
 
                 sqlite3_step(stmt);
-                sqlite3_finalize(stmt);
+                sqlite3_reset(stmt);
+                sqlite3_clear_bindings(stmt);
+                rows++;
             }
         }
+        sqlite3_finalize(stmt);
         config_.setProperty("status", "Saving data from \"" + hyperlistFile + "\" to database");
         sqlite3_exec(handle, "COMMIT TRANSACTION;", NULL, NULL, &error);
+        logImportRate(hyperlistFile, rows, startTime);
 
         return true;
     }
@@ -440,27 +500,21 @@ bool MetadataDatabase::importHyperlist(std::string hyperlistFile, std::string co
 
 bool MetadataDatabase::importMamelist(std::string filename, std::string collectionName)
 {
-    rapidxml::xml_document<> doc;
-    rapidxml::xml_node<> * rootNode;
     char *error = NULL;
     sqlite3 *handle = db_.handle;
+    Uint32 startTime = SDL_GetTicks();
 
     config_.setProperty("status", "Scraping data from \"" + filename + "\" (this will take a while)");
 
     Logger::write(Logger::ZONE_INFO, "Mamelist", "Importing mamelist file \"" + filename + "\" (this will take a while)");
-    std::ifstream file(filename.c_str());
-
-    std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-    buffer.push_back('\0');
+    // A current -listxml runs to hundreds of megabytes, so it is read one
+    // machine at a time rather than as a whole document
+    MameListParser parser(filename);
 
-    doc.parse<0>(&buffer[0]);
-
-    rootNode = doc.first_node("mame");
-
-    if(!rootNode)
+    if(!parser.open())
     {
-        Logger::write(Logger::ZONE_ERROR, "Metadata", "Does not appear to be a MameList file (missing <mame> tag)");
+        Logger::write(Logger::ZONE_ERROR, "Metadata", "Could not parse mamelist file \"" + filename + "\": " + parser.getError());
         return false;
     }
 
@@ -470,80 +524,52 @@ bool MetadataDatabase::importMamelist(std::string filename, std::string collecti
         Logger::write(Logger::ZONE_ERROR, "Metadata", "SQL Error starting transaction: " + emsg);
         return false;
     };
-    std::string gameNodeName = "game";
-
-    // support new mame formats
-    if(rootNode->first_node(gameNodeName.c_str()) == NULL) {
-        gameNodeName = "machine";
+    sqlite3_stmt *stmt;
+    if(sqlite3_prepare_v2(handle,
+                          "INSERT OR REPLACE INTO Meta (name, title, year, manufacturer, genre, players, buttons, cloneOf, collectionName) VALUES (?,?,?,?,?,?,?,?,?)",
+                          -1, &stmt, 0) != SQLITE_OK)
+    {
+        std::string emsg = sqlite3_errmsg(handle);
+        Logger::write(Logger::ZONE_ERROR, "Metadata", "SQL Error preparing the mamelist insert: " + emsg);
+        sqlite3_exec(handle, "ROLLBACK TRANSACTION;", NULL, NULL, &error);
+        return false;
     }
+    int rows = 0;
 
-    for (rapidxml::xml_node<> * game = rootNode->first_node(gameNodeName.c_str()); game; game = game->next_sibling())
+    MameListParser::Machine machine;
+    while(parser.next(machine))
     {
-        rapidxml::xml_attribute<> *nameNode = game->first_attribute("name");
-        rapidxml::xml_attribute<> *cloneOfXml = game->first_attribute("cloneof");
-
-        if(nameNode != NULL)
+        if(machine.name != "")
         {
-            std::string name = nameNode->value();
-            rapidxml::xml_node<> *descriptionNode = game->first_node("description");
-            rapidxml::xml_node<> *yearNode = game->first_node("year");
-            rapidxml::xml_node<> *manufacturerNode = game->first_node("manufacturer");
-            rapidxml::xml_node<> *genreNode = game->first_node("genre");
-            rapidxml::xml_node<> *inputNode = game->first_node("input");
-
-            std::string description = (descriptionNode == NULL) ? nameNode->value() : descriptionNode->value();
-            std::string year = (yearNode == NULL) ? "" : yearNode->value();
-            std::string manufacturer = (manufacturerNode == NULL) ? "" : manufacturerNode->value();
-            std::string genre = (genreNode == NULL) ? "" : genreNode->value();
-            std::string cloneOf = (cloneOfXml == NULL) ? "" : cloneOfXml->value();
-            std::string players;
-            std::string buttons;
-
-            if(inputNode != NULL)
-            {
-                rapidxml::xml_attribute<> *playersAttribute = inputNode->first_attribute("players");
-                rapidxml::xml_attribute<> *buttonsAttribute = inputNode->first_attribute("buttons");
-
-                if(playersAttribute)
-                {
-                    players = playersAttribute->value();
-                }
-
-                if(buttonsAttribute)
-                {
-                    buttons = buttonsAttribute->value();
-                }
-
-            }
-
-            sqlite3_stmt *stmt;
-
-            sqlite3_prepare_v2(handle,
-                               "INSERT OR REPLACE INTO Meta (name, title, year, manufacturer, genre, players, buttons, cloneOf, collectionName) VALUES (?,?,?,?,?,?,?,?,?)",
-                               -1, &stmt, 0);
-
-
-            sqlite3_bind_text(stmt, 1, name.c_str(), -1, SQLITE_TRANSIENT);
-            sqlite3_bind_text(stmt, 2, description.c_str(), -1, SQLITE_TRANSIENT);
-            sqlite3_bind_text(stmt, 3, year.c_str(), -1, SQLITE_TRANSIENT);
-            sqlite3_bind_text(stmt, 4, manufacturer.c_str(), -1, SQLITE_TRANSIENT);
-            sqlite3_bind_text(stmt, 5, genre.c_str(), -1, SQLITE_TRANSIENT);
-            sqlite3_bind_text(stmt, 6, players.c_str(), -1, SQLITE_TRANSIENT);
-            sqlite3_bind_text(stmt, 7, buttons.c_str(), -1, SQLITE_TRANSIENT);
-            sqlite3_bind_text(stmt, 8, cloneOf.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 1, machine.name.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 2, machine.description.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 3, machine.year.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 4, machine.manufacturer.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 5, machine.genre.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 6, machine.players.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 7, machine.buttons.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 8, machine.cloneOf.c_str(), -1, SQLITE_TRANSIENT);
             sqlite3_bind_text(stmt, 9, collectionName.c_str(), -1, SQLITE_TRANSIENT);
 
-            if (int code = sqlite3_step(stmt) != SQLITE_DONE)
+            int code = sqlite3_step(stmt);
+            if (code != SQLITE_DONE)
             {
                 std::stringstream ss;
-                ss << "Failed to insert machine \"" << name << "\" into database; " << sqlite3_errstr(code) << "; " << sqlite3_errmsg(handle);
+                ss << "Failed to insert machine \"" << machine.name << "\" into database; " << sqlite3_errstr(code) << "; " << sqlite3_errmsg(handle);
                 Logger::write(Logger::ZONE_ERROR, "Metadata", ss.str());
-                sqlite3_finalize(stmt);
                 break;
             };
-            sqlite3_finalize(stmt);
+            sqlite3_reset(stmt);
+            sqlite3_clear_bindings(stmt);
+            rows++;
         }
     }
+    sqlite3_finalize(stmt);
+
+    if(parser.hasError())
+    {
+        Logger::write(Logger::ZONE_ERROR, "Metadata", "Could not parse mamelist file \"" + filename + "\": " + parser.getError());
+    }
 
     config_.setProperty("status", "Saving data from \"" + filename + "\" to database");
     if (sqlite3_exec(handle, "COMMIT TRANSACTION;", NULL, NULL, &error) != SQLITE_OK)
@@ -551,6 +577,7 @@ bool MetadataDatabase::importMamelist(std::string filename, std::string collecti
         std::string emsg = error;
         Logger::write(Logger::ZONE_ERROR, "Metadata", "SQL Error closing transaction: " + emsg);
     };
+    logImportRate(filename, rows, startTime);
 
     return true;
 }
@@ -559,6 +586,7 @@ bool MetadataDatabase::importMamelist(std::string filename, std::string collecti
 bool MetadataDatabase::importEmuArclist(std::string emuarclistFile)
 {
     char *error = NULL;
+    Uint32 startTime = SDL_GetTicks();
 
     config_.setProperty("status", "Scraping data from \"" + emuarclistFile + "\"");
     rapidxml::xml_document<> doc;
@@ -599,7 +627,18 @@ bool MetadataDatabase::importEmuArclist(std::string emuarclistFile)
         }
         sqlite3 *handle = db_.handle;
         sqlite3_exec(handle, "BEGIN IMMEDIATE TRANSACTION;", NULL, NULL, &error);
-        
+        sqlite3_stmt *stmt;
+        if(sqlite3_prepare_v2(handle,
+                              "INSERT OR REPLACE INTO Meta (name, title, year, manufacturer, developer, genre, players, ctrltype, buttons, joyways, cloneOf, collectionName, rating, score) VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?)",
+                              -1, &stmt, 0) != SQLITE_OK)
+        {
+            std::string emsg = sqlite3_errmsg(handle);
+            Logger::write(Logger::ZONE_ERROR, "Metadata", "SQL Error preparing the emuarclist insert: " + emsg);
+            sqlite3_exec(handle, "ROLLBACK TRANSACTION;", NULL, NULL, &error);
+            return false;
+        }
+        int rows = 0;
+
 
         for(rapidxml::xml_node<> *game = root->first_node("game"); game; game = game->next_sibling("game"))
         {
@@ -608,6 +647,8 @@ bool MetadataDatabase::importEmuArclist(std::string emuarclistFile)
             if (!emuarcXml)
             {
                 Logger::write(Logger::ZONE_ERROR, "Metadata", "Does not appear to be a EmuArcList SuperDat file (missing <emuarc> tag)");
+                sqlite3_finalize(stmt);
+                sqlite3_exec(handle, "ROLLBACK TRANSACTION;", NULL, NULL, &error);
                 return false;
             }
             rapidxml::xml_node<> *cloneofXml       = emuarcXml->first_node("cloneof");
@@ -639,12 +680,6 @@ bool MetadataDatabase::importEmuArclist(std::string emuarclistFile)
 
             if(name.length() > 0)
             {
-                sqlite3_stmt *stmt;
-
-                sqlite3_prepare_v2(handle,
-                                   "INSERT OR REPLACE INTO Meta (name, title, year, manufacturer, developer, genre, players, ctrltype, buttons, joyways, cloneOf, collectionName, rating, score) VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?)",
-                                   -1, &stmt, 0);
-
                 sqlite3_bind_text(stmt,  1, name.c_str(), -1, SQLITE_TRANSIENT);
                 sqlite3_bind_text(stmt,  2, description.c_str(), -1, SQLITE_TRANSIENT);
                 sqlite3_bind_text(stmt,  3, year.c_str(), -1, SQLITE_TRANSIENT);
@@ -661,11 +696,15 @@ bool MetadataDatabase::importEmuArclist(std::string emuarclistFile)
                 sqlite3_bind_text(stmt, 14, score.c_str(), -1, SQLITE_TRANSIENT);
 
                 sqlite3_step(stmt);
-                sqlite3_finalize(stmt);
+                sqlite3_reset(stmt);
+                sqlite3_clear_bindings(stmt);
+                rows++;
             }
         }
+        sqlite3_finalize(stmt);
         config_.setProperty("status", "Saving data from \"" + emuarclistFile + "\" to database");
         sqlite3_exec(handle, "COMMIT TRANSACTION;", NULL, NULL, &error);
+        logImportRate(emuarclistFile, rows, startTime);
 
         return true;
     }
@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <SDL2/SDL.h>
 
 class DB;
 class Configuration;
@@ -39,6 +40,9 @@ public:
 
 private:
     bool importDirectory();
+    void beginImport();
+    void endImport();
+    void logImportRate(std::string filename, int rows, Uint32 startTime);
     bool needsRefresh();
     time_t timeDir(std::string path);
     Configuration &config_;
@@ -18,19 +18,52 @@
 #include <string>
 
 
+static const char *eventNames[EVENT_MAX] =
+{
+    "enter",
+    "exit",
+    "idle",
+    "menuIdle",
+    "menuScroll",
+    "highlightEnter",
+    "highlightExit",
+    "menuEnter",
+    "menuExit",
+    "gameEnter",
+    "gameExit",
+    "playlistEnter",
+    "playlistExit",
+    "menuJumpEnter",
+    "menuJumpExit",
+    "attractEnter",
+    "attract",
+    "attractExit",
+    "jukeboxJump",
+    "menuActionInputEnter",
+    "menuActionInputExit",
+    "menuActionSelectEnter",
+    "menuActionSelectExit"
+};
+
 
 AnimationEvents::AnimationEvents()
+    : animations_(EVENT_MAX)
 {
 }
 
 AnimationEvents::AnimationEvents(AnimationEvents &copy)
+    : animations_(EVENT_MAX)
 {
-    for(std::map<std::string, std::map<int , Animation *> >::iterator it = copy.animationMap_.begin(); it != copy.animationMap_.end(); it++)
+    for(unsigned int event = 0; event < copy.animations_.size(); event++)
     {
-        for(std::map<int, Animation *>::iterator it2 = (it->second).begin(); it2 != (it->second).end(); it2++)
+        std::vector<Animation *> &row = copy.animations_[event];
+        animations_[event].resize(row.size(), NULL);
+        for(unsigned int slot = 0; slot < row.size(); slot++)
         {
-            Animation *t = new Animation(*it2->second);
-            animationMap_[it->first][it2->first] = t;
+            if(row[slot])
+            {
+                animations_[event][slot] = new Animation(*row[slot]);
+            }
         }
     }
 }
@@ -40,48 +73,63 @@ AnimationEvents::~AnimationEvents()
     clear();
 }
 
-Animation *AnimationEvents::getAnimation(std::string tween)
-{
-    return getAnimation(tween, -1);
-}
-
-Animation *AnimationEvents::getAnimation(std::string tween, int index)
+// Returns EVENT_NONE for names that no layout tag can define.
+int AnimationEvents::getEventId(std::string name)
 {
-    if(animationMap_.find(tween) == animationMap_.end())
-        animationMap_[tween][-1] = new Animation();
-
-    if(animationMap_[tween].find(index) == animationMap_[tween].end())
+    for(int event = 0; event < EVENT_MAX; event++)
     {
-        index = -1;
-        if(animationMap_[tween].find(index) == animationMap_[tween].end())
+        if(name == eventNames[event])
         {
-            animationMap_[tween][index] = new Animation();
+            return event;
         }
     }
-    return animationMap_[tween][index];
+    return EVENT_NONE;
 }
 
-void AnimationEvents::setAnimation(std::string tween, int index, Animation *animation)
+// Falls back to the default (-1) animation of the event when there is none
+// for the given menu index. Returns NULL if the event has no animation.
+Animation *AnimationEvents::getAnimation(int event, int index)
 {
-    animationMap_[tween][index] = animation;
+    if(event < 0 || event >= EVENT_MAX)
+        return NULL;
+
+    std::vector<Animation *> &row = animations_[event];
+    unsigned int slot = index + 1;
+
+    if(index >= -1 && slot < row.size() && row[slot])
+        return row[slot];
+
+    return (row.size() > 0) ? row[0] : NULL;
+}
+
+void AnimationEvents::setAnimation(int event, int index, Animation *animation)
+{
+    // Indexes below -1 can never be looked up
+    if(event < 0 || event >= EVENT_MAX || index < -1)
+    {
+        delete animation;
+        return;
+    }
+
+    std::vector<Animation *> &row = animations_[event];
+    unsigned int slot = index + 1;
+
+    if(slot >= row.size())
+        row.resize(slot + 1, NULL);
+
+    delete row[slot];
+    row[slot] = animation;
 }
 
 void AnimationEvents::clear()
 {
-    std::map<std::string, std::map<int, Animation *> >::iterator it = animationMap_.begin();
-    while(it != animationMap_.end())
+    for(unsigned int event = 0; event < animations_.size(); event++)
     {
-        std::map<int, Animation *>::iterator it2 = (it->second).begin();
-        while(it2 != (it->second).end())
+        std::vector<Animation *> &row = animations_[event];
+        for(unsigned int slot = 0; slot < row.size(); slot++)
         {
-            delete it2->second;
-            (it->second).erase(it2);
+            delete row[slot];
         }
-
-        (it->second).clear();
-        animationMap_.erase(it);
-        it = animationMap_.begin();
+        row.clear();
     }
-
-    animationMap_.clear();
 }
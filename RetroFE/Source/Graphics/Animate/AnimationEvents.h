@@ -19,7 +19,37 @@
 #include "Animation.h"
 #include <string>
 #include <vector>
-#include <map>
+
+// Layout event names are interned to these ids when the layout is parsed,
+// so that per-frame animation lookups and idle checks compare integers.
+enum AnimationEvent
+{
+    EVENT_NONE = -1,
+    EVENT_ENTER,
+    EVENT_EXIT,
+    EVENT_IDLE,
+    EVENT_MENU_IDLE,
+    EVENT_MENU_SCROLL,
+    EVENT_HIGHLIGHT_ENTER,
+    EVENT_HIGHLIGHT_EXIT,
+    EVENT_MENU_ENTER,
+    EVENT_MENU_EXIT,
+    EVENT_GAME_ENTER,
+    EVENT_GAME_EXIT,
+    EVENT_PLAYLIST_ENTER,
+    EVENT_PLAYLIST_EXIT,
+    EVENT_MENU_JUMP_ENTER,
+    EVENT_MENU_JUMP_EXIT,
+    EVENT_ATTRACT_ENTER,
+    EVENT_ATTRACT,
+    EVENT_ATTRACT_EXIT,
+    EVENT_JUKEBOX_JUMP,
+    EVENT_MENU_ACTION_INPUT_ENTER,
+    EVENT_MENU_ACTION_INPUT_EXIT,
+    EVENT_MENU_ACTION_SELECT_ENTER,
+    EVENT_MENU_ACTION_SELECT_EXIT,
+    EVENT_MAX
+};
 
 class AnimationEvents
 {
@@ -28,11 +58,14 @@ public:
     AnimationEvents(AnimationEvents &copy);
     ~AnimationEvents();
 
-    Animation *getAnimation(std::string tween);
-    Animation *getAnimation(std::string tween, int index);
-    void setAnimation(std::string tween, int index, Animation *animation);
+    static int getEventId(std::string name);
+
+    Animation *getAnimation(int event, int index = -1);
+    void setAnimation(int event, int index, Animation *animation);
     void clear();
 
 private:
-    std::map<std::string, std::map<int, Animation *> > animationMap_;
+    // One row per event, indexed by menu index + 1 so that the default
+    // (menu index -1) animation is in slot 0.
+    std::vector<std::vector<Animation *> > animations_;
 };
@@ -33,6 +33,16 @@ Tween::Tween(TweenProperty property, TweenAlgorithm type, double start, double e
 }
 
 
+void Tween::reset(TweenAlgorithm type, double start, double end, double duration)
+{
+    this->type     = type;
+    this->start    = start;
+    this->end      = end;
+    this->duration = duration;
+    startDefined   = true;
+}
+
+
 bool Tween::getTweenProperty(std::string name, TweenProperty &property)
 {
     bool retVal = false;
@@ -228,6 +238,115 @@ float Tween::animateSingle(TweenAlgorithm type, double start, double end, double
 
 }
 
+template<double (*ease)(double, double, double, double)>
+void Tween::animateBatch(unsigned int count, const double *elapsedTime, const double *duration, const double *start, const double *change, float *result)
+{
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        result[i] = static_cast<float>(ease(elapsedTime[i], duration[i], start[i], change[i]));
+    }
+}
+
+
+
+// Evaluate count tweens that share one algorithm. The arrays are walked in
+// a single tight loop per algorithm so the compiler can vectorize it.
+void Tween::animateBatch(TweenAlgorithm type, unsigned int count, const double *elapsedTime, const double *duration, const double *start, const double *change, float *result)
+{
+    switch(type)
+    {
+    case EASE_IN_QUADRATIC:
+        animateBatch<easeInQuadratic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_OUT_QUADRATIC:
+        animateBatch<easeOutQuadratic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_INOUT_QUADRATIC:
+        animateBatch<easeInOutQuadratic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_IN_CUBIC:
+        animateBatch<easeInCubic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_OUT_CUBIC:
+        animateBatch<easeOutCubic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_INOUT_CUBIC:
+        animateBatch<easeInOutCubic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_IN_QUARTIC:
+        animateBatch<easeInQuartic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_OUT_QUARTIC:
+        animateBatch<easeOutQuartic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_INOUT_QUARTIC:
+        animateBatch<easeInOutQuartic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_IN_QUINTIC:
+        animateBatch<easeInQuintic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_OUT_QUINTIC:
+        animateBatch<easeOutQuintic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_INOUT_QUINTIC:
+        animateBatch<easeInOutQuintic>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_IN_SINE:
+        animateBatch<easeInSine>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_OUT_SINE:
+        animateBatch<easeOutSine>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_INOUT_SINE:
+        animateBatch<easeInOutSine>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_IN_EXPONENTIAL:
+        animateBatch<easeInExponential>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_OUT_EXPONENTIAL:
+        animateBatch<easeOutExponential>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_INOUT_EXPONENTIAL:
+        animateBatch<easeInOutExponential>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_IN_CIRCULAR:
+        animateBatch<easeInCircular>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_OUT_CIRCULAR:
+        animateBatch<easeOutCircular>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case EASE_INOUT_CIRCULAR:
+        animateBatch<easeInOutCircular>(count, elapsedTime, duration, start, change, result);
+        break;
+
+    case LINEAR:
+    default:
+        animateBatch<linear>(count, elapsedTime, duration, start, change, result);
+        break;
+    }
+}
+
+
 double Tween::linear(double t, double d, double b, double c)
 {
     if(d == 0) return b;
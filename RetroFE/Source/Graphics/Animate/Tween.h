@@ -26,9 +26,11 @@ class Tween
 public:
 
     Tween(TweenProperty name, TweenAlgorithm type, double start, double end, double duration);
+    void reset(TweenAlgorithm type, double start, double end, double duration);
     float animate(double elapsedTime);
     float animate(double elapsedTime, double startValue);
     static float animateSingle(TweenAlgorithm type, double start, double end, double duration, double elapsedTime);
+    static void animateBatch(TweenAlgorithm type, unsigned int count, const double *elapsedTime, const double *duration, const double *start, const double *change, float *result);
     static TweenAlgorithm getTweenType(std::string name);
     static bool getTweenProperty(std::string name, TweenProperty &property);
     TweenProperty property;
@@ -36,6 +38,11 @@ public:
     bool   startDefined;
 
 private:
+    friend class TweenSet;
+
+    template<double (*ease)(double, double, double, double)>
+    static void animateBatch(unsigned int count, const double *elapsedTime, const double *duration, const double *start, const double *change, float *result);
+
     static double easeInQuadratic(double elapsedTime, double duration, double b, double c);
     static double easeOutQuadratic(double elapsedTime, double duration, double b, double c);
     static double easeInOutQuadratic(double elapsedTime, double duration, double b, double c);
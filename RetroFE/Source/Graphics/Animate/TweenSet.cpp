@@ -15,11 +15,38 @@
  */
 #include "TweenSet.h"
 
+float ViewInfo::* const TweenSet::members_[TWEEN_PROPERTY_NOP] =
+{
+    &ViewInfo::Height,
+    &ViewInfo::Width,
+    &ViewInfo::Angle,
+    &ViewInfo::Alpha,
+    &ViewInfo::X,
+    &ViewInfo::Y,
+    &ViewInfo::XOrigin,
+    &ViewInfo::YOrigin,
+    &ViewInfo::XOffset,
+    &ViewInfo::YOffset,
+    &ViewInfo::FontSize,
+    &ViewInfo::BackgroundAlpha,
+    &ViewInfo::MaxWidth,
+    &ViewInfo::MaxHeight,
+    NULL,                        // layer is an integer
+    &ViewInfo::ContainerX,
+    &ViewInfo::ContainerY,
+    &ViewInfo::ContainerWidth,
+    &ViewInfo::ContainerHeight,
+    &ViewInfo::Volume,
+    NULL                         // monitor is an integer
+};
+
 TweenSet::TweenSet()
+    : compiled_(false)
 {
 }
 
 TweenSet::TweenSet(TweenSet &copy)
+    : compiled_(false)
 {
     for(std::vector<Tween *>::iterator it = copy.set_.begin(); it != copy.set_.end(); it++)
     {
@@ -36,10 +63,19 @@ TweenSet::~TweenSet()
 void TweenSet::push(Tween *tween)
 {
     set_.push_back(tween);
+    compiled_ = false;
+}
+
+void TweenSet::reset(unsigned int index, TweenAlgorithm type, double start, double end, double duration)
+{
+    set_[index]->reset(type, start, end, duration);
+    compiled_ = false;
 }
 
 void TweenSet::clear()
 {
+    compiled_ = false;
+
     std::vector<Tween *>::iterator it = set_.begin();
     while(it != set_.end())
     {
@@ -63,3 +99,155 @@ unsigned int TweenSet::size()
 {
     return set_.size();
 }
+
+
+// Raise value to the largest start or end the tweens of property set;
+// returns false if no tween sets it
+bool TweenSet::getMaximum(TweenProperty property, float &value)
+{
+    bool found = false;
+    for(unsigned int i = 0; i < set_.size(); ++i)
+    {
+        Tween *tween = set_[i];
+        if(tween->property != property)
+        {
+            continue;
+        }
+        if(tween->startDefined && tween->start > value)
+        {
+            value = static_cast<float>(tween->start);
+        }
+        if(tween->end > value)
+        {
+            value = static_cast<float>(tween->end);
+        }
+        found = true;
+    }
+    return found;
+}
+
+
+// Apply all tweens to view at elapsedTime; tweens without a start value
+// begin at the value in store. Returns true once every tween has finished.
+bool TweenSet::animate(double elapsedTime, ViewInfo &view, ViewInfo &store)
+{
+    if(!compiled_)
+    {
+        compile();
+    }
+
+    unsigned int count = property_.size();
+    bool done = true;
+
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        if(elapsedTime < duration_[i])
+        {
+            elapsed_[i] = elapsedTime;
+            done        = false;
+        }
+        else
+        {
+            elapsed_[i] = duration_[i];
+        }
+    }
+
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        begin_[i]  = (startDefined_[i]) ? start_[i] : getValue(store, property_[i]);
+        change_[i] = end_[i] - begin_[i];
+    }
+
+    unsigned int first = 0;
+    for(unsigned int g = 0; g < groups_.size(); ++g)
+    {
+        Tween::animateBatch(algorithm_[first], groups_[g] - first, &elapsed_[first], &duration_[first], &begin_[first], &change_[first], &value_[first]);
+        first = groups_[g];
+    }
+
+    // write back in push order so the last tween of a property wins
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        unsigned int j = order_[i];
+        setValue(view, property_[j], value_[j]);
+    }
+
+    return done;
+}
+
+
+void TweenSet::compile()
+{
+    unsigned int count = set_.size();
+    std::vector<unsigned int> &sorted = groups_;
+
+    // stable insertion sort of the tween indices by algorithm, using
+    // groups_ as scratch space until the groups are known
+    sorted.clear();
+    for(unsigned int i = 0; i < count; ++i)
+    {
+        unsigned int pos = sorted.size();
+        sorted.push_back(i);
+        while(pos > 0 && set_[sorted[pos - 1]]->type > set_[i]->type)
+        {
+            sorted[pos] = sorted[pos - 1];
+            pos--;
+        }
+        sorted[pos] = i;
+    }
+
+    algorithm_.resize(count);
+    property_.resize(count);
+    startDefined_.resize(count);
+    start_.resize(count);
+    end_.resize(count);
+    duration_.resize(count);
+    order_.resize(count);
+    elapsed_.resize(count);
+    begin_.resize(count);
+    change_.resize(count);
+    value_.resize(count);
+
+    for(unsigned int pos = 0; pos < count; ++pos)
+    {
+        Tween *tween       = set_[sorted[pos]];
+        algorithm_[pos]    = tween->type;
+        property_[pos]     = tween->property;
+        startDefined_[pos] = tween->startDefined;
+        start_[pos]        = tween->start;
+        end_[pos]          = tween->end;
+        duration_[pos]     = tween->duration;
+        order_[sorted[pos]] = pos;
+    }
+
+    groups_.clear();
+    for(unsigned int pos = 1; pos <= count; ++pos)
+    {
+        if(pos == count || algorithm_[pos] != algorithm_[pos - 1])
+        {
+            groups_.push_back(pos);
+        }
+    }
+
+    compiled_ = true;
+}
+
+
+float TweenSet::getValue(ViewInfo &view, TweenProperty property)
+{
+    if(property == TWEEN_PROPERTY_LAYER)   return static_cast<float>(view.Layer);
+    if(property == TWEEN_PROPERTY_MONITOR) return static_cast<float>(view.Monitor);
+    if(property < TWEEN_PROPERTY_NOP)      return view.*members_[property];
+    return 0;
+}
+
+
+void TweenSet::setValue(ViewInfo &view, TweenProperty property, float value)
+{
+    if(property == TWEEN_PROPERTY_LAYER)
+        view.Layer = static_cast<unsigned int>(value);
+    else if(property == TWEEN_PROPERTY_MONITOR)
+        view.Monitor = static_cast<unsigned int>(value);
+    else if(property < TWEEN_PROPERTY_NOP)
+        view.*members_[property] = value;
+}
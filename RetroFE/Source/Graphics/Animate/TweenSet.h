@@ -16,6 +16,7 @@
 #pragma once
 
 #include "Tween.h"
+#include "../ViewInfo.h"
 #include <vector>
 
 class TweenSet
@@ -25,11 +26,39 @@ public:
     TweenSet(TweenSet &copy);
     ~TweenSet();
     void push(Tween * tween);
+    void reset(unsigned int index, TweenAlgorithm type, double start, double end, double duration);
     void clear();
     std::vector<Tween *> *tweens();
     Tween *getTween(unsigned int index);
     unsigned int size();
+    bool getMaximum(TweenProperty property, float &value);
+    bool animate(double elapsedTime, ViewInfo &view, ViewInfo &store);
 
 private:
+    void compile();
+    static float getValue(ViewInfo &view, TweenProperty property);
+    static void setValue(ViewInfo &view, TweenProperty property, float value);
+
+    static float ViewInfo::* const members_[TWEEN_PROPERTY_NOP];
+
     std::vector<Tween *> set_;
+
+    // Struct-of-arrays copy of the tweens, sorted by algorithm. groups_
+    // holds the end of each run of equal algorithms, order_ the sorted
+    // position of every tween in push order.
+    bool                        compiled_;
+    std::vector<TweenAlgorithm> algorithm_;
+    std::vector<TweenProperty>  property_;
+    std::vector<char>           startDefined_;
+    std::vector<double>         start_;
+    std::vector<double>         end_;
+    std::vector<double>         duration_;
+    std::vector<unsigned int>   order_;
+    std::vector<unsigned int>   groups_;
+
+    // per frame scratch space
+    std::vector<double>         elapsed_;
+    std::vector<double>         begin_;
+    std::vector<double>         change_;
+    std::vector<float>          value_;
 };
@@ -20,6 +20,10 @@
 #include "../../SDL.h"
 #include "../PageBuilder.h"
 
+float        Component::reloadSettleTime_ = 0.15f;
+unsigned int Component::reloadCount_      = 0;
+unsigned int Component::reloadsAvoided_   = 0;
+
 Component::Component(Page &p)
 : page(p)
 {
@@ -53,11 +57,13 @@ Component::~Component()
 
 void Component::freeGraphicsMemory()
 {
-    animationRequestedType_ = "";
-    animationType_          = "";
+    animationRequestedType_ = EVENT_NONE;
+    animationType_          = EVENT_NONE;
     animationRequested_     = false;
     newItemSelected         = false;
     newScrollItemSelected   = false;
+    reloadPending_          = false;
+    reloadWait_             = 0;
     menuIndex_              = -1;
 
     currentTweens_        = NULL;
@@ -80,7 +86,7 @@ void Component::allocateGraphicsMemory()
     {
         // make a 4x4 pixel wide surface to be stretched during rendering, make it a white background so we can use
         // color  later
-        SDL_Surface *surface = SDL_CreateRGBSurface(0, 4, 4, 32, 0, 0, 0, 0);
+        SDL_Surface *surface = SDL_CreateRGBSurface(0, BACKGROUND_SIZE, BACKGROUND_SIZE, 32, 0, 0, 0, 0);
         SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 255, 255, 255));
 
         SDL_LockMutex(SDL::getMutex());
@@ -103,7 +109,7 @@ void Component::initializeFonts()
 }
 
 
-void Component::triggerEvent(std::string event, int menuIndex)
+void Component::triggerEvent(int event, int menuIndex)
 {
     animationRequestedType_ = event;
     animationRequested_     = true;
@@ -132,17 +138,17 @@ void Component::setId( int id )
 
 bool Component::isIdle()
 {
-    return (currentTweenComplete_ || animationType_ == "idle" || animationType_ == "menuIdle" || animationType_ == "attract");
+    return (currentTweenComplete_ || animationType_ == EVENT_IDLE || animationType_ == EVENT_MENU_IDLE || animationType_ == EVENT_ATTRACT);
 }
 
 bool Component::isAttractIdle()
 {
-    return (currentTweenComplete_ || animationType_ == "idle" || animationType_ == "menuIdle");
+    return (currentTweenComplete_ || animationType_ == EVENT_IDLE || animationType_ == EVENT_MENU_IDLE);
 }
 
 bool Component::isMenuScrolling()
 {
-    return (!currentTweenComplete_ && animationType_ == "menuScroll");
+    return (!currentTweenComplete_ && animationType_ == EVENT_MENU_SCROLL);
 }
 
 void Component::setTweens(AnimationEvents *set)
@@ -154,7 +160,7 @@ void Component::update(float dt)
 {
     elapsedTweenTime_ += dt;
 
-    if ( animationRequested_ && animationRequestedType_ != "" )
+    if ( animationRequested_ && animationRequestedType_ != EVENT_NONE )
     {
       Animation *newTweens;
       // Check if this component is part of an active scrolling list
@@ -187,11 +193,11 @@ void Component::update(float dt)
 
     if (tweens_ && currentTweenComplete_)
     {
-        animationType_        = "idle";
-        currentTweens_        = tweens_->getAnimation( "idle", menuIndex_ );
-        if ( currentTweens_ && currentTweens_->size( ) == 0 && !page.isMenuScrolling( ) )
+        animationType_        = EVENT_IDLE;
+        currentTweens_        = tweens_->getAnimation( EVENT_IDLE, menuIndex_ );
+        if ( (!currentTweens_ || currentTweens_->size( ) == 0) && !page.isMenuScrolling( ) )
         {
-            currentTweens_    = tweens_->getAnimation( "menuIdle", menuIndex_ );
+            currentTweens_    = tweens_->getAnimation( EVENT_MENU_IDLE, menuIndex_ );
             if ( currentTweens_ && currentTweens_->size( ) > 0 )
             {
                 currentTweens_ = currentTweens_;
@@ -229,7 +235,14 @@ void Component::draw()
                                static_cast<char>(baseViewInfo.BackgroundGreen*255),
                                static_cast<char>(baseViewInfo.BackgroundBlue*255));
 
-        SDL::renderCopy(backgroundTexture_, baseViewInfo.BackgroundAlpha, NULL, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
+        // the background texture is always BACKGROUND_SIZE square
+        SDL_Rect srcRect;
+        srcRect.x = 0;
+        srcRect.y = 0;
+        srcRect.w = BACKGROUND_SIZE;
+        srcRect.h = BACKGROUND_SIZE;
+
+        SDL::renderCopy(backgroundTexture_, baseViewInfo.BackgroundAlpha, &srcRect, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
     }
 }
 
@@ -242,173 +255,8 @@ bool Component::animate()
     }
     else if ( currentTweens_ )
     {
-        bool currentDone = true;
         TweenSet *tweens = currentTweens_->tweenSet(currentTweenIndex_);
-
-        for(unsigned int i = 0; i < tweens->size(); i++)
-        {
-            Tween *tween = tweens->tweens()->at(i);
-            double elapsedTime = elapsedTweenTime_;
-
-            //todo: too many levels of nesting
-            if ( elapsedTime < tween->duration )
-                currentDone = false;
-            else
-                elapsedTime = static_cast<float>(tween->duration);
-
-            switch(tween->property)
-            {
-            case TWEEN_PROPERTY_X:
-                if (tween->startDefined)
-                    baseViewInfo.X = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.X = tween->animate(elapsedTime, storeViewInfo_.X);
-                break;
-
-            case TWEEN_PROPERTY_Y:
-                if (tween->startDefined)
-                    baseViewInfo.Y = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Y = tween->animate(elapsedTime, storeViewInfo_.Y);
-                break;
-
-            case TWEEN_PROPERTY_HEIGHT:
-                if (tween->startDefined)
-                    baseViewInfo.Height = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Height = tween->animate(elapsedTime, storeViewInfo_.Height);
-                break;
-
-            case TWEEN_PROPERTY_WIDTH:
-                if (tween->startDefined)
-                    baseViewInfo.Width = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Width = tween->animate(elapsedTime, storeViewInfo_.Width);
-                break;
-
-            case TWEEN_PROPERTY_ANGLE:
-                if (tween->startDefined)
-                    baseViewInfo.Angle = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Angle = tween->animate(elapsedTime, storeViewInfo_.Angle);
-                break;
-
-            case TWEEN_PROPERTY_ALPHA:
-                if (tween->startDefined)
-                    baseViewInfo.Alpha = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Alpha = tween->animate(elapsedTime, storeViewInfo_.Alpha);
-                break;
-
-            case TWEEN_PROPERTY_X_ORIGIN:
-                if (tween->startDefined)
-                    baseViewInfo.XOrigin = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.XOrigin = tween->animate(elapsedTime, storeViewInfo_.XOrigin);
-                break;
-
-            case TWEEN_PROPERTY_Y_ORIGIN:
-                if (tween->startDefined)
-                    baseViewInfo.YOrigin = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.YOrigin = tween->animate(elapsedTime, storeViewInfo_.YOrigin);
-                break;
-
-            case TWEEN_PROPERTY_X_OFFSET:
-                if (tween->startDefined)
-                    baseViewInfo.XOffset = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.XOffset = tween->animate(elapsedTime, storeViewInfo_.XOffset);
-                break;
-
-            case TWEEN_PROPERTY_Y_OFFSET:
-                if (tween->startDefined)
-                    baseViewInfo.YOffset = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.YOffset = tween->animate(elapsedTime, storeViewInfo_.YOffset);
-                break;
-
-            case TWEEN_PROPERTY_FONT_SIZE:
-                if (tween->startDefined)
-                    baseViewInfo.FontSize = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.FontSize = tween->animate(elapsedTime, storeViewInfo_.FontSize);
-                break;
-
-            case TWEEN_PROPERTY_BACKGROUND_ALPHA:
-                if (tween->startDefined)
-                    baseViewInfo.BackgroundAlpha = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.BackgroundAlpha = tween->animate(elapsedTime, storeViewInfo_.BackgroundAlpha);
-                break;
-
-            case TWEEN_PROPERTY_MAX_WIDTH:
-                if (tween->startDefined)
-                    baseViewInfo.MaxWidth = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.MaxWidth = tween->animate(elapsedTime, storeViewInfo_.MaxWidth);
-                break;
-
-            case TWEEN_PROPERTY_MAX_HEIGHT:
-                if (tween->startDefined)
-                    baseViewInfo.MaxHeight = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.MaxHeight = tween->animate(elapsedTime, storeViewInfo_.MaxHeight);
-                break;
-
-            case TWEEN_PROPERTY_LAYER:
-                if (tween->startDefined)
-                    baseViewInfo.Layer = static_cast<unsigned int>(tween->animate(elapsedTime));
-                else
-                    baseViewInfo.Layer = static_cast<unsigned int>(tween->animate(elapsedTime, storeViewInfo_.Layer));
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_X:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerX = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerX = tween->animate(elapsedTime, storeViewInfo_.ContainerX);
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_Y:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerY = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerY = tween->animate(elapsedTime, storeViewInfo_.ContainerY);
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_WIDTH:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerWidth = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerWidth = tween->animate(elapsedTime, storeViewInfo_.ContainerWidth);
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_HEIGHT:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerHeight = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerHeight = tween->animate(elapsedTime, storeViewInfo_.ContainerHeight);
-                break;
-
-            case TWEEN_PROPERTY_VOLUME:
-                if (tween->startDefined)
-                    baseViewInfo.Volume = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Volume = tween->animate(elapsedTime, storeViewInfo_.Volume);
-                break;
-
-            case TWEEN_PROPERTY_MONITOR:
-                if (tween->startDefined)
-                    baseViewInfo.Monitor = static_cast<unsigned int>(tween->animate(elapsedTime));
-                else
-                    baseViewInfo.Monitor = static_cast<unsigned int>(tween->animate(elapsedTime, storeViewInfo_.Monitor));
-                break;
-
-            case TWEEN_PROPERTY_NOP:
-                break;
-            }
-        }
+        bool currentDone = tweens->animate(elapsedTweenTime_, baseViewInfo, storeViewInfo_);
 
         if ( currentDone )
         {
@@ -456,3 +304,69 @@ int Component::getId( )
 {
     return id_;
 }
+
+
+void Component::setReloadSettleTime(float settleTime)
+{
+    reloadSettleTime_ = settleTime;
+}
+
+
+unsigned int Component::getReloadCount()
+{
+    return reloadCount_;
+}
+
+
+unsigned int Component::getReloadsAvoided()
+{
+    return reloadsAvoided_;
+}
+
+
+// Whether media should be reloaded for the selected item now. While the
+// menu scrolls, a reload waits until the selection has stayed put for
+// reloadSettleTime_, so items that are only passed over are never loaded.
+bool Component::isReloadDue(bool requested, float dt)
+{
+    if(requested)
+    {
+        if(reloadPending_)
+        {
+            reloadsAvoided_++;
+        }
+        reloadPending_ = true;
+        reloadWait_    = 0;
+    }
+    else if(reloadPending_)
+    {
+        reloadWait_ += dt;
+    }
+
+    if(!reloadPending_ || (page.isMenuScrolling() && reloadWait_ < reloadSettleTime_))
+    {
+        return false;
+    }
+
+    reloadPending_ = false;
+    reloadCount_++;
+    return true;
+}
+
+
+bool Component::isReloadPending()
+{
+    return reloadPending_;
+}
+
+
+// The largest value the running tween set moves property to, or value if
+// that is larger or nothing animates the property
+float Component::getAnimatedMaximum(TweenProperty property, float value)
+{
+    if(currentTweens_ && currentTweenIndex_ < currentTweens_->size())
+    {
+        currentTweens_->tweenSet(currentTweenIndex_)->getMaximum(property, value);
+    }
+    return value;
+}
@@ -33,7 +33,7 @@ public:
     virtual void allocateGraphicsMemory();
     virtual void deInitializeFonts();
     virtual void initializeFonts();
-    void triggerEvent(std::string event, int menuIndex = -1);
+    void triggerEvent(int event, int menuIndex = -1);
     void setPlaylist(std::string name );
     void setNewItemSelected();
     void setNewScrollItemSelected();
@@ -62,11 +62,18 @@ public:
     std::string collectionName;
     void setMenuScrollReload(bool menuScrollReload);
     bool getMenuScrollReload();
+    static void setReloadSettleTime(float settleTime);
+    static unsigned int getReloadCount();
+    static unsigned int getReloadsAvoided();
     virtual void setText(std::string text, int id = -1) {};
     virtual void setImage(std::string filePath, int id = -1) {};
     int getId( );
 
 protected:
+    bool isReloadDue(bool requested, float dt);
+    bool isReloadPending();
+    float getAnimatedMaximum(TweenProperty property, float value);
+
     Page &page;
 
     std::string playlistName;
@@ -78,16 +85,23 @@ private:
 
     AnimationEvents *tweens_;
     Animation *currentTweens_;
+    static const int BACKGROUND_SIZE = 4;
     SDL_Texture *backgroundTexture_;
 
     ViewInfo     storeViewInfo_;
     unsigned int currentTweenIndex_;
     bool         currentTweenComplete_;
     float        elapsedTweenTime_;
-    std::string  animationRequestedType_;
-    std::string  animationType_;
+    int          animationRequestedType_;
+    int          animationType_;
     bool         animationRequested_;
     bool         menuScrollReload_;
+    bool         reloadPending_;
+    float        reloadWait_;
     int          menuIndex_;
     int          id_;
+
+    static float        reloadSettleTime_;
+    static unsigned int reloadCount_;
+    static unsigned int reloadsAvoided_;
 };
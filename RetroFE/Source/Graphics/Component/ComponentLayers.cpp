@@ -0,0 +1,100 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ComponentLayers.h"
+#include "Component.h"
+#include <algorithm>
+
+
+ComponentLayers::ComponentLayers()
+    : buckets_(NUM_LAYERS)
+{
+}
+
+
+// Sync the buckets with the list. Components that changed layer (tweens
+// can animate it) are moved; a changed list is bucketed from scratch.
+// Components on a layer of NUM_LAYERS or above are not drawn.
+void ComponentLayers::update(std::vector<Component *> &components)
+{
+    if(components.size() != components_.size())
+    {
+        rebuild(components);
+        return;
+    }
+
+    for(unsigned int i = 0; i < components.size(); ++i)
+    {
+        Component *c = components[i];
+        if(c != components_[i])
+        {
+            rebuild(components);
+            return;
+        }
+        if(c && c->baseViewInfo.Layer != layers_[i])
+        {
+            move(i, c->baseViewInfo.Layer);
+        }
+    }
+}
+
+
+void ComponentLayers::draw(unsigned int layer)
+{
+    if(layer >= NUM_LAYERS) return;
+
+    std::vector<unsigned int> &bucket = buckets_[layer];
+    for(unsigned int i = 0; i < bucket.size(); ++i)
+    {
+        components_[bucket[i]]->draw();
+    }
+}
+
+
+void ComponentLayers::rebuild(std::vector<Component *> &components)
+{
+    components_ = components;
+    layers_.assign(components_.size(), NO_LAYER);
+    for(unsigned int i = 0; i < buckets_.size(); ++i)
+    {
+        buckets_[i].clear();
+    }
+
+    for(unsigned int i = 0; i < components_.size(); ++i)
+    {
+        if(components_[i])
+        {
+            move(i, components_[i]->baseViewInfo.Layer);
+        }
+    }
+}
+
+
+void ComponentLayers::move(unsigned int index, unsigned int layer)
+{
+    if(layers_[index] < NUM_LAYERS)
+    {
+        std::vector<unsigned int> &old = buckets_[layers_[index]];
+        old.erase(std::lower_bound(old.begin(), old.end(), index));
+    }
+
+    if(layer < NUM_LAYERS)
+    {
+        std::vector<unsigned int> &bucket = buckets_[layer];
+        bucket.insert(std::upper_bound(bucket.begin(), bucket.end(), index), index);
+    }
+    layers_[index] = layer;
+}
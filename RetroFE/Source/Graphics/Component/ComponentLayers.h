@@ -0,0 +1,43 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <vector>
+
+class Component;
+
+// Keeps a list of components bucketed by layer, so that they can be drawn
+// in one ordered walk instead of one pass over the list per layer. Within a
+// layer, components keep the order they have in the list.
+class ComponentLayers
+{
+public:
+    static const unsigned int NUM_LAYERS = 20;
+
+    ComponentLayers();
+    void update(std::vector<Component *> &components);
+    void draw(unsigned int layer);
+
+private:
+    void rebuild(std::vector<Component *> &components);
+    void move(unsigned int index, unsigned int layer);
+
+    static const unsigned int NO_LAYER = static_cast<unsigned int>(-1);
+
+    std::vector<Component *> components_;
+    std::vector<unsigned int> layers_;
+    std::vector<std::vector<unsigned int> > buckets_;
+};
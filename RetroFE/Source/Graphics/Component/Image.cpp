@@ -15,16 +15,28 @@
  */
 #include "Image.h"
 #include "../ViewInfo.h"
+#include "../ImageLoader.h"
+#include "../TextureCache.h"
+#include "../ThumbnailCache.h"
 #include "../../SDL.h"
 #include "../../Utility/Log.h"
 #include <SDL2/SDL_image.h>
 
-Image::Image(std::string file, std::string altFile, Page &p, int monitor)
+Image::Image(std::string file, std::string altFile, Page &p, int monitor, bool async, int thumbnailWidth, int thumbnailHeight)
     : Component(p)
     , texture_(NULL)
     , file_(file)
     , altFile_(altFile)
+    , async_(async)
+    , loading_(false)
+    , textureMonitor_(monitor)
+    , thumbnailWidth_(thumbnailWidth)
+    , thumbnailHeight_(thumbnailHeight)
 {
+    if(async_ && ImageLoader::isEnabled())
+    {
+        thumbnail_ = ThumbnailCache::getPath(file_, thumbnailWidth_, thumbnailHeight_);
+    }
     baseViewInfo.Monitor = monitor;
     allocateGraphicsMemory();
 }
@@ -38,42 +50,161 @@ void Image::freeGraphicsMemory()
 {
     Component::freeGraphicsMemory();
 
-    SDL_LockMutex(SDL::getMutex());
+    if (loading_)
+    {
+        ImageLoader::release(loadingFile_);
+        loading_ = false;
+    }
+
     if (texture_ != NULL)
     {
-        SDL_DestroyTexture(texture_);
+        TextureCache::release(textureFile_, textureMonitor_);
         texture_ = NULL;
     }
-    SDL_UnlockMutex(SDL::getMutex());
 }
 
 void Image::allocateGraphicsMemory()
+{
+    // while a decode is pending, update() uploads its result; acquiring a
+    // cached copy meanwhile would leave the component holding two references
+    if(!texture_ && !loading_)
+    {
+        if(!acquireTexture(thumbnail_) && !acquireTexture(file_) && !acquireTexture(altFile_))
+        {
+            if(async_ && ImageLoader::isEnabled())
+            {
+                // decoding happens in the background; update() uploads the result
+                requestSurface((thumbnail_ != "") ? thumbnail_ : file_);
+            }
+            else
+            {
+                if(!loadTexture(file_))
+                {
+                    loadTexture(altFile_);
+                }
+            }
+        }
+    }
+
+    Component::allocateGraphicsMemory();
+
+}
+
+
+bool Image::acquireTexture(std::string file)
+{
+    if (file == "") return false;
+
+    texture_ = TextureCache::acquire(file, baseViewInfo.Monitor);
+    if (texture_)
+    {
+        setTexture(file);
+    }
+
+    return texture_ != NULL;
+}
+
+
+bool Image::loadTexture(std::string file)
+{
+    if (file == "") return false;
+
+    SDL_LockMutex(SDL::getMutex());
+    SDL_Texture *texture = IMG_LoadTexture(SDL::getRenderer(baseViewInfo.Monitor), file.c_str());
+    if (texture != NULL)
+    {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        texture_ = TextureCache::insert(file, baseViewInfo.Monitor, texture);
+        setTexture(file);
+    }
+    SDL_UnlockMutex(SDL::getMutex());
+
+    return texture_ != NULL;
+}
+
+
+void Image::setTexture(std::string file)
 {
     int width;
     int height;
 
-    if(!texture_)
+    SDL_QueryTexture(texture_, NULL, NULL, &width, &height);
+    baseViewInfo.ImageWidth  = (float)width;
+    baseViewInfo.ImageHeight = (float)height;
+    textureRect_.x = 0;
+    textureRect_.y = 0;
+    textureRect_.w = width;
+    textureRect_.h = height;
+    textureFile_    = file;
+    textureMonitor_ = baseViewInfo.Monitor;
+}
+
+
+void Image::requestSurface(std::string file)
+{
+    if(thumbnail_ != "" && file == thumbnail_)
+    {
+        ImageLoader::request(file, file_, thumbnailWidth_, thumbnailHeight_);
+    }
+    else
+    {
+        ImageLoader::request(file);
+    }
+    loadingFile_ = file;
+    loading_     = true;
+}
+
+
+void Image::uploadSurface()
+{
+    SDL_Surface *surface = NULL;
+
+    if (!ImageLoader::poll(loadingFile_, surface))
+    {
+        return;
+    }
+
+    if (surface)
     {
         SDL_LockMutex(SDL::getMutex());
-        texture_ = IMG_LoadTexture(SDL::getRenderer(baseViewInfo.Monitor), file_.c_str());
-        if (!texture_ && altFile_ != "")
+        SDL_Texture *texture = SDL_CreateTextureFromSurface(SDL::getRenderer(baseViewInfo.Monitor), surface);
+        if (texture_ != NULL)
         {
-            texture_ = IMG_LoadTexture(SDL::getRenderer(baseViewInfo.Monitor), altFile_.c_str());
+            // already holding a texture; inserting would take a second reference
+            if (texture != NULL)
+            {
+                SDL_DestroyTexture(texture);
+            }
         }
-
-        if (texture_ != NULL)
+        else if (texture != NULL)
         {
-            SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
-            SDL_QueryTexture(texture_, NULL, NULL, &width, &height);
-            baseViewInfo.ImageWidth  = (float)width;
-            baseViewInfo.ImageHeight = (float)height;
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            texture_ = TextureCache::insert(loadingFile_, baseViewInfo.Monitor, texture);
+            setTexture(loadingFile_);
         }
         SDL_UnlockMutex(SDL::getMutex());
+    }
 
+    std::string file = loadingFile_;
+    ImageLoader::release(file);
+    loading_ = false;
+
+    if (!texture_ && altFile_ != "" && file != altFile_)
+    {
+        requestSurface(altFile_);
     }
+}
 
-    Component::allocateGraphicsMemory();
 
+void Image::update(float dt)
+{
+    // nothing but the background is drawn until the decoded image arrives
+    if (loading_)
+    {
+        uploadSurface();
+    }
+
+    Component::update(dt);
 }
 
 
@@ -90,6 +221,6 @@ void Image::draw()
         rect.h = static_cast<int>(baseViewInfo.ScaledHeight());
         rect.w = static_cast<int>(baseViewInfo.ScaledWidth());
 
-        SDL::renderCopy(texture_, baseViewInfo.Alpha, NULL, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
+        SDL::renderCopy(texture_, baseViewInfo.Alpha, &textureRect_, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
     }
 }
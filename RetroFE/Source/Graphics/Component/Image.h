@@ -22,14 +22,32 @@
 class Image : public Component
 {
 public:
-    Image(std::string file, std::string altFile, Page &p, int monitor);
+    Image(std::string file, std::string altFile, Page &p, int monitor, bool async = false, int thumbnailWidth = 0, int thumbnailHeight = 0);
     virtual ~Image();
     void freeGraphicsMemory();
     void allocateGraphicsMemory();
+    void update(float dt);
     void draw();
 
 protected:
     SDL_Texture *texture_;
     std::string  file_;
     std::string  altFile_;
+
+private:
+    bool acquireTexture(std::string file);
+    bool loadTexture(std::string file);
+    void setTexture(std::string file);
+    void requestSurface(std::string file);
+    void uploadSurface();
+
+    bool         async_;
+    bool         loading_;
+    std::string  loadingFile_;
+    std::string  textureFile_;
+    int          textureMonitor_;
+    SDL_Rect     textureRect_;
+    std::string  thumbnail_;
+    int          thumbnailWidth_;
+    int          thumbnailHeight_;
 };
@@ -18,9 +18,22 @@
 #include "../../Utility/Log.h"
 #include <fstream>
 
-Image * ImageBuilder::CreateImage(std::string path, Page &p, std::string name, int monitor)
+Image * ImageBuilder::CreateImage(std::string path, Page &p, std::string name, int monitor, bool async)
 {
     Image *image = NULL;
+    std::string file;
+
+    if(FindImage(path, name, file))
+    {
+        image = new Image(file, "", p, monitor, async);
+    }
+
+    return image;
+}
+
+
+bool ImageBuilder::FindImage(std::string path, std::string name, std::string &file)
+{
     std::vector<std::string> extensions;
 
     extensions.push_back("png");
@@ -31,12 +44,6 @@ Image * ImageBuilder::CreateImage(std::string path, Page &p, std::string name, i
     extensions.push_back("JPEG");
 
     std::string prefix = Utils::combinePath(path, name);
-    std::string file;
 
-    if(Utils::findMatchingFile(prefix, extensions, file))
-    {
-        image = new Image(file, "", p, monitor);
-    }
-
-    return image;
+    return Utils::findMatchingFile(prefix, extensions, file);
 }
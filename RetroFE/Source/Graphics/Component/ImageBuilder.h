@@ -24,5 +24,6 @@
 class ImageBuilder
 {
 public:
-    Image * CreateImage(std::string path, Page &p, std::string name, int monitor);
+    Image * CreateImage(std::string path, Page &p, std::string name, int monitor, bool async = false);
+    bool FindImage(std::string path, std::string name, std::string &file);
 };
@@ -51,6 +51,8 @@ ReloadableMedia::ReloadableMedia(Configuration &config, bool systemMode, bool la
 
 ReloadableMedia::~ReloadableMedia()
 {
+    VideoFactory::releasePrerolls(this);
+
     if (loadedComponent_ != NULL)
     {
         delete loadedComponent_;
@@ -64,14 +66,22 @@ void ReloadableMedia::enableTextFallback_(bool value)
 
 void ReloadableMedia::update(float dt)
 {
-    if (newItemSelected ||
-       (newScrollItemSelected && getMenuScrollReload()) ||
-        type_ == "isPaused")
+    bool reload = isReloadDue(newItemSelected || (newScrollItemSelected && getMenuScrollReload()), dt);
+    newItemSelected       = false;
+    newScrollItemSelected = false;
+
+    if (reload || type_ == "isPaused")
     {
 
         reloadTexture();
-        newItemSelected       = false;
-        newScrollItemSelected = false;
+        prerollNeighbours();
+    }
+    else if (isReloadPending() && loadedComponent_ && loadedComponent_->isPlaying())
+    {
+        // Keep the artwork of the previous item until the selection settles,
+        // but do not leave its video and sound running
+        delete loadedComponent_;
+        loadedComponent_ = NULL;
     }
 
     if(loadedComponent_)
@@ -130,109 +140,24 @@ void ReloadableMedia::reloadTexture()
 
     // build clone list
     std::vector<std::string> names;
-
-    names.push_back(selectedItem->name);
-    names.push_back(selectedItem->fullTitle);
-    if(selectedItem->cloneof.length() > 0)
-    {
-        names.push_back(selectedItem->cloneof);
-    }
+    buildNames(selectedItem, names);
 
     std::string typeLC = Utils::toLower(type_);
-    if (typeLC == "isfavorite")
-    {
-        if (selectedItem->isFavorite)
-        {
-            names.push_back("yes");
-        }
-        else
-        {
-            names.push_back("no");
-        }
-    }
-    if (typeLC == "ispaused")
-    {
-        if (page.isPaused( ))
-        {
-            names.push_back("yes");
-        }
-        else
-        {
-            names.push_back("no");
-        }
-    }
-
-    names.push_back("default");
 
     if(isVideo_)
     {
-        for(unsigned int n = 0; n < names.size() && !loadedComponent_; ++n)
+        std::string file;
+        if(findVideo(selectedItem, names, file))
         {
-            std::string basename = names[n];
-            if(systemMode_)
-            {
-
-                // check the master collection for the system artifact 
-                loadedComponent_ = findComponent(collectionName, type_, type_, "", true, true);
-
-                // check the collection for the system artifact
-                if(!loadedComponent_)
-                {
-                  loadedComponent_ = findComponent(selectedItem->collectionInfo->name, type_, type_, "", true, true);
-                }
-
-            }
-            else
-            {
-
-                // are we looking at a leaf or a submenu
-                if (selectedItem->leaf) // item is a leaf
-                {
-
-                  // check the master collection for the artifact 
-                  loadedComponent_ = findComponent(collectionName, type_, basename, "", false, true);
-
-                  // check the collection for the artifact
-                  if(!loadedComponent_)
-                  {
-                    loadedComponent_ = findComponent(selectedItem->collectionInfo->name, type_, basename, "", false, true);
-                  }
-
-                  // check the rom directory for the artifact
-                  if(!loadedComponent_)
-                  {
-                    loadedComponent_ = findComponent(selectedItem->collectionInfo->name, type_, type_, selectedItem->filepath, false, true);
-                  }
-
-                }
-                else // item is a submenu
-                {
-
-                  // check the master collection for the artifact 
-                  loadedComponent_ = findComponent(collectionName, type_, basename, "", false, true);
-
-                  // check the collection for the artifact
-                  if(!loadedComponent_)
-                  {
-                    loadedComponent_ = findComponent(selectedItem->collectionInfo->name, type_, basename, "", false, true);
-                  }
-
-                  // check the submenu collection for the system artifact
-                  if (!loadedComponent_)
-                  {
-                    loadedComponent_ = findComponent(selectedItem->name, type_, type_, "", true, true);
-                  } 
-
-                }
-
-            }
+            VideoBuilder videoBuild;
+            loadedComponent_ = videoBuild.createVideo(file, page, baseViewInfo.Monitor, type_ == "video", jukebox_ ? jukeboxNumLoops_ : -1);
+        }
 
-            if(loadedComponent_)
-            {
-                loadedComponent_->allocateGraphicsMemory();
-                baseViewInfo.ImageWidth = loadedComponent_->baseViewInfo.ImageWidth;
-                baseViewInfo.ImageHeight = loadedComponent_->baseViewInfo.ImageHeight;
-            }
+        if(loadedComponent_)
+        {
+            loadedComponent_->allocateGraphicsMemory();
+            baseViewInfo.ImageWidth = loadedComponent_->baseViewInfo.ImageWidth;
+            baseViewInfo.ImageHeight = loadedComponent_->baseViewInfo.ImageHeight;
         }
     }
 
@@ -420,12 +345,111 @@ void ReloadableMedia::reloadTexture()
 }
 
 
-Component *ReloadableMedia::findComponent(std::string collection, std::string type, std::string basename, std::string filepath, bool systemMode, bool isVideo)
+void ReloadableMedia::buildNames(Item *item, std::vector<std::string> &names)
+{
+    names.push_back(item->name);
+    names.push_back(item->fullTitle);
+    if(item->cloneof.length() > 0)
+    {
+        names.push_back(item->cloneof);
+    }
+
+    std::string typeLC = Utils::toLower(type_);
+    if (typeLC == "isfavorite")
+    {
+        if (item->isFavorite)
+        {
+            names.push_back("yes");
+        }
+        else
+        {
+            names.push_back("no");
+        }
+    }
+    if (typeLC == "ispaused")
+    {
+        if (page.isPaused( ))
+        {
+            names.push_back("yes");
+        }
+        else
+        {
+            names.push_back("no");
+        }
+    }
+
+    names.push_back("default");
+}
+
+
+bool ReloadableMedia::findVideo(Item *item, std::vector<std::string> &names, std::string &file)
+{
+    for(unsigned int n = 0; n < names.size(); ++n)
+    {
+        std::string basename = names[n];
+        if(systemMode_)
+        {
+
+            // check the master collection for the system artifact 
+            if(VideoBuilder::findVideo(getMediaPath(collectionName, type_, "", true), type_, file)) return true;
+
+            // check the collection for the system artifact
+            if(VideoBuilder::findVideo(getMediaPath(item->collectionInfo->name, type_, "", true), type_, file)) return true;
+
+        }
+        else
+        {
+
+            // check the master collection for the artifact 
+            if(VideoBuilder::findVideo(getMediaPath(collectionName, type_, "", false), basename, file)) return true;
+
+            // check the collection for the artifact
+            if(VideoBuilder::findVideo(getMediaPath(item->collectionInfo->name, type_, "", false), basename, file)) return true;
+
+            // are we looking at a leaf or a submenu
+            if (item->leaf) // item is a leaf
+            {
+                // check the rom directory for the artifact
+                if(VideoBuilder::findVideo(getMediaPath(item->collectionInfo->name, type_, item->filepath, false), type_, file)) return true;
+            }
+            else // item is a submenu
+            {
+                // check the submenu collection for the system artifact
+                if(VideoBuilder::findVideo(getMediaPath(item->name, type_, "", true), type_, file)) return true;
+            }
+
+        }
+    }
+
+    return false;
+}
+
+
+// The selection mostly moves one item at a time, so have the videos of the
+// neighbouring items ready to play
+void ReloadableMedia::prerollNeighbours()
+{
+    if(!isVideo_ || jukebox_ || !VideoFactory::isPrerollEnabled()) return;
+
+    for(int offset = -1; offset <= 1; offset += 2)
+    {
+        Item *item = page.getSelectedItem(displayOffset_ + offset);
+        if(!item) continue;
+
+        std::vector<std::string> names;
+        std::string file;
+        buildNames(item, names);
+        if(findVideo(item, names, file))
+        {
+            VideoFactory::preroll(baseViewInfo.Monitor, file, this);
+        }
+    }
+}
+
+
+std::string ReloadableMedia::getMediaPath(std::string collection, std::string type, std::string filepath, bool systemMode)
 {
     std::string imagePath;
-    Component *component = NULL;
-    VideoBuilder videoBuild;
-    ImageBuilder imageBuild;
 
     // check the system folder
     if (layoutMode_)
@@ -463,6 +487,19 @@ Component *ReloadableMedia::findComponent(std::string collection, std::string ty
     if ( filepath != "" )
         imagePath = filepath;
 
+    return imagePath;
+}
+
+
+Component *ReloadableMedia::findComponent(std::string collection, std::string type, std::string basename, std::string filepath, bool systemMode, bool isVideo)
+{
+    std::string imagePath;
+    Component *component = NULL;
+    VideoBuilder videoBuild;
+    ImageBuilder imageBuild;
+
+    imagePath = getMediaPath(collection, type, filepath, systemMode);
+
     if(isVideo)
     {
         if ( jukebox_ )
@@ -20,6 +20,7 @@
 #include "../../Collection/Item.h"
 #include <SDL2/SDL.h>
 #include <string>
+#include <vector>
 
 class Image;
 
@@ -50,6 +51,10 @@ public:
 
 private:
     void reloadTexture();
+    void buildNames(Item *item, std::vector<std::string> &names);
+    bool findVideo(Item *item, std::vector<std::string> &names, std::string &file);
+    void prerollNeighbours();
+    std::string getMediaPath(std::string collection, std::string type, std::string filepath, bool systemMode);
     Configuration &config_;
     bool systemMode_;
     bool layoutMode_;
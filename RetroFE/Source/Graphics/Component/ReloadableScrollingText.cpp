@@ -90,11 +90,13 @@ void ReloadableScrollingText::update(float dt)
         }
     }
 
-    if (newItemSelected ||
-       (newScrollItemSelected && getMenuScrollReload()))
+    bool reload = isReloadDue( newItemSelected || (newScrollItemSelected && getMenuScrollReload( )), dt );
+    newItemSelected       = false;
+    newScrollItemSelected = false;
+
+    if ( reload )
     {
         reloadTexture( );
-        newItemSelected = false;
     }
 
     Component::update(dt);
@@ -460,7 +462,7 @@ void ReloadableScrollingText::draw( )
         else                   // If not, use the general font settings
           font = fontInst_;
 
-        SDL_Texture *t = font->getTexture( );
+        std::vector<unsigned int> codes;
 
         float imageWidth     = 0;
         float imageMaxWidth  = 0;
@@ -505,12 +507,13 @@ void ReloadableScrollingText::draw( )
 
             for (unsigned int l = 0; l < text_.size( ); ++l)
             {
-                for (unsigned int i = 0; i < text_[l].size( ); ++i)
+                Utils::decodeUtf8( text_[l], codes );
+                for (unsigned int i = 0; i < codes.size( ); ++i)
                 {
 
                     Font::GlyphInfo glyph;
 
-                    if (font->getRect( text_[l][i], glyph) && glyph.rect.h > 0)
+                    if (font->getRect( codes[i], glyph) && glyph.rect.h > 0)
                     {
                         textWidth_ += static_cast<int>(glyph.advance * scale);
 
@@ -549,7 +552,7 @@ void ReloadableScrollingText::draw( )
                             }
                             if (rect.w > 0)
                             {
-                                SDL::renderCopy(t, baseViewInfo.Alpha, &charRect, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
+                                SDL::renderCopy(glyph.texture, baseViewInfo.Alpha, &charRect, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
                                 rect.x += rect.w;
                             }
                             else if ((rect.x + static_cast<int>( glyph.advance * scale )) >= (static_cast<int>( xOrigin ) + imageMaxWidth))
@@ -566,10 +569,11 @@ void ReloadableScrollingText::draw( )
             // Determine image width
             for (unsigned int l = 0; l < text_.size( ); ++l)
             {
-                for (unsigned int i = 0; i < text_[l].size( ); ++i)
+                Utils::decodeUtf8( text_[l], codes );
+                for (unsigned int i = 0; i < codes.size( ); ++i)
                 {
                     Font::GlyphInfo glyph;
-                    if (font->getRect( text_[l][i], glyph ))
+                    if (font->getRect( codes[i], glyph ))
                     {
                         imageWidth += glyph.advance;
                     }
@@ -615,10 +619,11 @@ void ReloadableScrollingText::draw( )
 
                     // Determine word image width
                     unsigned int wordWidth = 0;
-                    for (unsigned int i = 0; i < word.size( ); ++i)
+                    Utils::decodeUtf8( word, codes );
+                    for (unsigned int i = 0; i < codes.size( ); ++i)
                     {
                         Font::GlyphInfo glyph;
-                        if (font->getRect( word[i], glyph) )
+                        if (font->getRect( codes[i], glyph) )
                         {
                             wordWidth += static_cast<int>( glyph.advance * scale );
                         }
@@ -708,11 +713,12 @@ void ReloadableScrollingText::draw( )
                 while (iss >> word)
                 {
 
-                    for (unsigned int i = 0; i < word.size( ); ++i)
+                    Utils::decodeUtf8( word, codes );
+                    for (unsigned int i = 0; i < codes.size( ); ++i)
                     {
                         Font::GlyphInfo glyph;
 
-                        if (font->getRect( word[i], glyph) && glyph.rect.h > 0)
+                        if (font->getRect( codes[i], glyph) && glyph.rect.h > 0)
                         {
                             SDL_Rect charRect = glyph.rect;
                             rect.h   = static_cast<int>( charRect.h * scale );
@@ -739,7 +745,7 @@ void ReloadableScrollingText::draw( )
                                 }
                                 if (rect.h > 0)
                                 {
-                                    SDL::renderCopy(t, baseViewInfo.Alpha, &charRect, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
+                                    SDL::renderCopy(glyph.texture, baseViewInfo.Alpha, &charRect, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
                                 }
                             }
                             rect.x += static_cast<int>( glyph.advance * scale );
@@ -55,12 +55,14 @@ ReloadableText::~ReloadableText()
 
 void ReloadableText::update(float dt)
 {
-    if (newItemSelected ||
-       (newScrollItemSelected && getMenuScrollReload()) ||
+    bool reload = isReloadDue(newItemSelected || (newScrollItemSelected && getMenuScrollReload()), dt);
+    newItemSelected       = false;
+    newScrollItemSelected = false;
+
+    if (reload ||
         type_ == "time" || type_ == "current" || type_ == "duration" || type_ == "isPaused")
     {
         ReloadTexture();
-        newItemSelected = false;
     }
 
     // needs to be ran at the end to prevent the NewItemSelected flag from being detected
@@ -103,15 +105,17 @@ void ReloadableText::deInitializeFonts()
 
 void ReloadableText::ReloadTexture()
 {
-    if (imageInst_ != NULL)
-    {
-        delete imageInst_;
-        imageInst_ = NULL;
-    }
-
     Item *selectedItem = page.getSelectedItem();
 
-    if (selectedItem != NULL)
+    if (selectedItem == NULL)
+    {
+        if (imageInst_ != NULL)
+        {
+            delete imageInst_;
+            imageInst_ = NULL;
+        }
+    }
+    else
     {
         std::stringstream ss;
         std::string text = "";
@@ -334,7 +338,16 @@ void ReloadableText::ReloadTexture()
             ss << text;
         }
 
-        imageInst_ = new Text(ss.str(), page, fontInst_, baseViewInfo.Monitor);
+        // Keep the existing text, so its rendered string is only redrawn
+        // when the string actually changes
+        if (imageInst_ != NULL)
+        {
+            imageInst_->setText(ss.str());
+        }
+        else
+        {
+            imageInst_ = new Text(ss.str(), page, fontInst_, baseViewInfo.Monitor);
+        }
     }
 }
 
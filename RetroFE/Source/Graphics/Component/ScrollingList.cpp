@@ -27,6 +27,9 @@
 #include "VideoComponent.h"
 #include "ReloadableMedia.h"
 #include "Text.h"
+#include "../ImageLoader.h"
+#include "../TextureCache.h"
+#include "../ThumbnailCache.h"
 #include "../../Database/Configuration.h"
 #include "../../Collection/Item.h"
 #include "../../Utility/Utils.h"
@@ -34,12 +37,35 @@
 #include "../../SDL.h"
 #include "../ViewInfo.h"
 #include <math.h>
+#include <cfloat>
 #include <SDL2/SDL_image.h>
 #include <sstream>
 #include <cctype>
 #include <iomanip>
 
 
+const TweenProperty ScrollingList::scrollProperties_[ScrollingList::NUM_SCROLL_PROPERTIES] =
+{
+    TWEEN_PROPERTY_HEIGHT,
+    TWEEN_PROPERTY_WIDTH,
+    TWEEN_PROPERTY_ANGLE,
+    TWEEN_PROPERTY_ALPHA,
+    TWEEN_PROPERTY_X,
+    TWEEN_PROPERTY_Y,
+    TWEEN_PROPERTY_X_ORIGIN,
+    TWEEN_PROPERTY_Y_ORIGIN,
+    TWEEN_PROPERTY_X_OFFSET,
+    TWEEN_PROPERTY_Y_OFFSET,
+    TWEEN_PROPERTY_FONT_SIZE,
+    TWEEN_PROPERTY_BACKGROUND_ALPHA,
+    TWEEN_PROPERTY_MAX_WIDTH,
+    TWEEN_PROPERTY_MAX_HEIGHT,
+    TWEEN_PROPERTY_LAYER,
+    TWEEN_PROPERTY_VOLUME,
+    TWEEN_PROPERTY_MONITOR
+};
+
+
 ScrollingList::ScrollingList( Configuration &c,
                               Page          &p,
                               bool           layoutMode,
@@ -66,8 +92,12 @@ ScrollingList::ScrollingList( Configuration &c,
     , layoutKey_( layoutKey )
     , imageType_( imageType )
     , videoType_( videoType )
+    , prefetchTime_( 0 )
     , items_( NULL )
 {
+    int prefetchTime = 500;
+    config_.getProperty( "imagePrefetchTime", prefetchTime );
+    prefetchTime_ = static_cast<float>( prefetchTime ) / 1000;
 }
 
 
@@ -87,6 +117,8 @@ ScrollingList::ScrollingList( const ScrollingList &copy )
     , fontInst_( copy.fontInst_ )
     , layoutKey_( copy.layoutKey_ )
     , imageType_( copy.imageType_ )
+    , videoType_( copy.videoType_ )
+    , prefetchTime_( copy.prefetchTime_ )
     , items_( NULL )
 {
     scrollPoints_ = NULL;
@@ -112,6 +144,7 @@ ScrollingList::~ScrollingList( )
 void ScrollingList::setItems( std::vector<Item *> *items )
 {
     items_ = items;
+    prefetchFiles_.clear( );
     if ( items_ )
     {
         itemIndex_ = loopDecrement( 0, selectedOffsetIndex_, items_->size( ) );
@@ -484,6 +517,7 @@ void ScrollingList::freeGraphicsMemory( )
 {
     Component::freeGraphicsMemory( );
     scrollPeriod_ = 0;
+    prefetchFiles_.clear( );
     
     deallocateSpritePoints( );
 }
@@ -493,7 +527,7 @@ void ScrollingList::triggerEnterEvent( )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "enter" );
+        if ( c ) c->triggerEvent( EVENT_ENTER );
     }
 }
 
@@ -502,7 +536,7 @@ void ScrollingList::triggerExitEvent( )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at(i );
-        if ( c ) c->triggerEvent( "exit" );
+        if ( c ) c->triggerEvent( EVENT_EXIT );
     }
 }
 
@@ -511,7 +545,7 @@ void ScrollingList::triggerMenuEnterEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "menuEnter", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_MENU_ENTER, menuIndex );
     }
 }
 
@@ -520,7 +554,7 @@ void ScrollingList::triggerMenuExitEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "menuExit", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_MENU_EXIT, menuIndex );
     }
 }
 
@@ -529,7 +563,7 @@ void ScrollingList::triggerGameEnterEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "gameEnter", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_GAME_ENTER, menuIndex );
     }
 }
 
@@ -538,7 +572,7 @@ void ScrollingList::triggerGameExitEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "gameExit", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_GAME_EXIT, menuIndex );
     }
 }
 
@@ -547,7 +581,7 @@ void ScrollingList::triggerHighlightEnterEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "highlightEnter", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_HIGHLIGHT_ENTER, menuIndex );
     }
 }
 
@@ -556,7 +590,7 @@ void ScrollingList::triggerHighlightExitEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "highlightExit", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_HIGHLIGHT_EXIT, menuIndex );
     }
 }
 
@@ -565,7 +599,7 @@ void ScrollingList::triggerPlaylistEnterEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "playlistEnter", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_PLAYLIST_ENTER, menuIndex );
     }
 }
 
@@ -574,7 +608,7 @@ void ScrollingList::triggerPlaylistExitEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "playlistExit", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_PLAYLIST_EXIT, menuIndex );
     }
 }
 
@@ -583,7 +617,7 @@ void ScrollingList::triggerMenuJumpEnterEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "menuJumpEnter", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_MENU_JUMP_ENTER, menuIndex );
     }
 }
 
@@ -592,7 +626,7 @@ void ScrollingList::triggerMenuJumpExitEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "menuJumpExit", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_MENU_JUMP_EXIT, menuIndex );
     }
 }
 
@@ -601,7 +635,7 @@ void ScrollingList::triggerAttractEnterEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "attractEnter", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_ATTRACT_ENTER, menuIndex );
     }
 }
 
@@ -610,7 +644,7 @@ void ScrollingList::triggerAttractEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "attract", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_ATTRACT, menuIndex );
     }
 }
 
@@ -619,7 +653,7 @@ void ScrollingList::triggerAttractExitEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "attractExit", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_ATTRACT_EXIT, menuIndex );
     }
 }
 
@@ -628,7 +662,7 @@ void ScrollingList::triggerJukeboxJumpEvent( int menuIndex )
     for ( unsigned int i = 0; i < components_.size( ); ++i )
     {
         Component *c = components_.at( i );
-        if ( c ) c->triggerEvent( "jukeboxJump", menuIndex );
+        if ( c ) c->triggerEvent( EVENT_JUKEBOX_JUMP, menuIndex );
     }
 }
 
@@ -684,29 +718,67 @@ void ScrollingList::resetTweens( Component *c, AnimationEvents *sets, ViewInfo *
 
     c->setTweens(sets );
 
-    Animation *scrollTween = sets->getAnimation("menuScroll" );
-    scrollTween->Clear( );
+    Animation *scrollTween = sets->getAnimation( EVENT_MENU_SCROLL );
+    if ( !scrollTween )
+    {
+        scrollTween = new Animation( );
+        sets->setAnimation( EVENT_MENU_SCROLL, -1, scrollTween );
+    }
     c->baseViewInfo = *currentViewInfo;
 
-    TweenSet *set = new TweenSet( );
-    set->push(new Tween(TWEEN_PROPERTY_HEIGHT, LINEAR, currentViewInfo->Height, nextViewInfo->Height, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_WIDTH, LINEAR, currentViewInfo->Width, nextViewInfo->Width, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_ANGLE, LINEAR, currentViewInfo->Angle, nextViewInfo->Angle, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_ALPHA, LINEAR, currentViewInfo->Alpha, nextViewInfo->Alpha, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_X, LINEAR, currentViewInfo->X, nextViewInfo->X, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_Y, LINEAR, currentViewInfo->Y, nextViewInfo->Y, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_X_ORIGIN, LINEAR, currentViewInfo->XOrigin, nextViewInfo->XOrigin, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_Y_ORIGIN, LINEAR, currentViewInfo->YOrigin, nextViewInfo->YOrigin, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_X_OFFSET, LINEAR, currentViewInfo->XOffset, nextViewInfo->XOffset, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_Y_OFFSET, LINEAR, currentViewInfo->YOffset, nextViewInfo->YOffset, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_FONT_SIZE, LINEAR, currentViewInfo->FontSize, nextViewInfo->FontSize, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_BACKGROUND_ALPHA, LINEAR, currentViewInfo->BackgroundAlpha, nextViewInfo->BackgroundAlpha, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_MAX_WIDTH, LINEAR, currentViewInfo->MaxWidth, nextViewInfo->MaxWidth, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_MAX_HEIGHT, LINEAR, currentViewInfo->MaxHeight, nextViewInfo->MaxHeight, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_LAYER, LINEAR, currentViewInfo->Layer, nextViewInfo->Layer, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_VOLUME, LINEAR, currentViewInfo->Volume, nextViewInfo->Volume, scrollTime ) );
-    set->push(new Tween(TWEEN_PROPERTY_MONITOR, LINEAR, currentViewInfo->Monitor, nextViewInfo->Monitor, scrollTime ) );
-    scrollTween->Push( set );
+    // The scroll animation is rebuilt on every scroll step, so keep its
+    // tweens and only update their values
+    TweenSet *set;
+    if ( scrollTween->size( ) == 1 && scrollTween->tweenSet( 0 )->size( ) == NUM_SCROLL_PROPERTIES )
+    {
+        set = scrollTween->tweenSet( 0 );
+    }
+    else
+    {
+        scrollTween->Clear( );
+        set = new TweenSet( );
+        for ( unsigned int i = 0; i < NUM_SCROLL_PROPERTIES; i++ )
+        {
+            set->push( new Tween( scrollProperties_[i], LINEAR, 0, 0, 0 ) );
+        }
+        scrollTween->Push( set );
+    }
+
+    for ( unsigned int i = 0; i < NUM_SCROLL_PROPERTIES; i++ )
+    {
+        TweenProperty property = set->getTween( i )->property;
+        set->reset( i, LINEAR, getViewValue( currentViewInfo, property ), getViewValue( nextViewInfo, property ), scrollTime );
+    }
+}
+
+
+double ScrollingList::getViewValue( ViewInfo *info, TweenProperty property )
+{
+    switch ( property )
+    {
+    case TWEEN_PROPERTY_HEIGHT:           return info->Height;
+    case TWEEN_PROPERTY_WIDTH:            return info->Width;
+    case TWEEN_PROPERTY_ANGLE:            return info->Angle;
+    case TWEEN_PROPERTY_ALPHA:            return info->Alpha;
+    case TWEEN_PROPERTY_X:                return info->X;
+    case TWEEN_PROPERTY_Y:                return info->Y;
+    case TWEEN_PROPERTY_X_ORIGIN:         return info->XOrigin;
+    case TWEEN_PROPERTY_Y_ORIGIN:         return info->YOrigin;
+    case TWEEN_PROPERTY_X_OFFSET:         return info->XOffset;
+    case TWEEN_PROPERTY_Y_OFFSET:         return info->YOffset;
+    case TWEEN_PROPERTY_FONT_SIZE:        return info->FontSize;
+    case TWEEN_PROPERTY_BACKGROUND_ALPHA: return info->BackgroundAlpha;
+    case TWEEN_PROPERTY_MAX_WIDTH:        return info->MaxWidth;
+    case TWEEN_PROPERTY_MAX_HEIGHT:       return info->MaxHeight;
+    case TWEEN_PROPERTY_LAYER:            return info->Layer;
+    case TWEEN_PROPERTY_CONTAINER_X:      return info->ContainerX;
+    case TWEEN_PROPERTY_CONTAINER_Y:      return info->ContainerY;
+    case TWEEN_PROPERTY_CONTAINER_WIDTH:  return info->ContainerWidth;
+    case TWEEN_PROPERTY_CONTAINER_HEIGHT: return info->ContainerHeight;
+    case TWEEN_PROPERTY_VOLUME:           return info->Volume;
+    case TWEEN_PROPERTY_MONITOR:          return info->Monitor;
+    default:                              return 0;
+    }
 }
 
 
@@ -717,18 +789,139 @@ bool ScrollingList::allocateTexture( unsigned int index, Item *item )
 
     std::string imagePath;
     std::string videoPath;
+    std::string file;
 
     Component *t = NULL;
 
-    ImageBuilder imageBuild;
     VideoBuilder videoBuild;
 
-    std::string layoutName;
-    config_.getProperty( "layout", layoutName );
+    if ( videoType_ != "null" )
+    {
+        std::string layoutName;
+        config_.getProperty( "layout", layoutName );
+
+        std::vector<std::string> names;
+        getArtNames( item, names );
+
+        for ( unsigned int n = 0; n < names.size() && !t; ++n )
+        {
+            // check collection path for art
+            if ( layoutMode_ )
+            {
+                if ( commonMode_ )
+                    imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
+                else
+                    imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", collectionName );
+                imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
+                videoPath = Utils::combinePath( imagePath, "medium_artwork", videoType_ );
+            }
+            else
+            {
+                if ( commonMode_ )
+                {
+                    imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
+                    imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
+                    videoPath = Utils::combinePath( imagePath, "medium_artwork", videoType_ );
+                }
+                else
+                {
+                    config_.getMediaPropertyAbsolutePath( collectionName, videoType_, false, videoPath );
+                }
+            }
+            t = videoBuild.createVideo( videoPath, page, names[n], baseViewInfo.Monitor, false );
 
+            // check sub-collection path for art
+            if ( !t && !commonMode_ )
+            {
+                if ( layoutMode_ )
+                {
+                    imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", item->collectionInfo->name );
+                    imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
+                    videoPath = Utils::combinePath( imagePath, "medium_artwork", videoType_ );
+                }
+                else
+                {
+                    config_.getMediaPropertyAbsolutePath( item->collectionInfo->name, videoType_, false, videoPath );
+                }
+                t = videoBuild.createVideo( videoPath, page, names[n], baseViewInfo.Monitor, false );
+            }
+        }
+
+        // check collection path for art based on system name
+        if ( !t )
+        {
+            if ( layoutMode_ )
+            {
+                if ( commonMode_ )
+                    videoPath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
+                else
+                    videoPath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", item->name );
+                videoPath = Utils::combinePath( videoPath, "system_artwork" );
+            }
+            else
+            {
+                if ( commonMode_ )
+                {
+                    videoPath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
+                    videoPath = Utils::combinePath( videoPath, "system_artwork" );
+                }
+                else
+                {
+                    config_.getMediaPropertyAbsolutePath( item->name, videoType_, true, videoPath );
+                }
+            }
+            t = videoBuild.createVideo( videoPath, page, videoType_, baseViewInfo.Monitor, false );
+        }
+
+        // check rom directory path for art
+        if ( !t )
+        {
+            t = videoBuild.createVideo( item->filepath, page, videoType_, baseViewInfo.Monitor, false );
+        }
+    }
+
+    // Use the art resolved by the prefetcher, or look for it now. Video
+    // lists fall back to image art in case no video could be found.
+    if ( !t )
+    {
+        std::map<Item *, std::string>::iterator it = prefetchFiles_.find( item );
+        bool found;
+        if ( it != prefetchFiles_.end( ) )
+        {
+            file  = it->second;
+            found = (file != "");
+        }
+        else
+        {
+            found = findImageFile( item, file );
+        }
+        if ( found )
+        {
+            int thumbnailWidth;
+            int thumbnailHeight;
+            getThumbnailSize( thumbnailWidth, thumbnailHeight );
+            t = new Image( file, "", page, baseViewInfo.Monitor, true, thumbnailWidth, thumbnailHeight );
+        }
+    }
+
+    if ( !t )
+    {
+        t = new Text(item->title, page, fontInst_, baseViewInfo.Monitor );
+    }
+
+    if ( t )
+    {
+        components_.at( index ) = t;
+    }
+
+    return true;
+}
+
+
+void ScrollingList::getArtNames( Item *item, std::vector<std::string> &names )
+{
     std::string typeLC = Utils::toLower( imageType_ );
 
-    std::vector<std::string> names;
     names.push_back( item->name );
     names.push_back( item->fullTitle );
     if ( item->cloneof != "" )
@@ -765,8 +958,22 @@ bool ScrollingList::allocateTexture( unsigned int index, Item *item )
     if ( typeLC == "score" )
         names.push_back( item->score );
     names.push_back("default");
+}
+
+
+bool ScrollingList::findImageFile( Item *item, std::string &file )
+{
+    std::string imagePath;
+
+    ImageBuilder imageBuild;
+
+    std::string layoutName;
+    config_.getProperty( "layout", layoutName );
+
+    std::vector<std::string> names;
+    getArtNames( item, names );
 
-    for ( unsigned int n = 0; n < names.size() && !t; ++n )
+    for ( unsigned int n = 0; n < names.size(); ++n )
     {
         // check collection path for art
         if ( layoutMode_ )
@@ -776,7 +983,6 @@ bool ScrollingList::allocateTexture( unsigned int index, Item *item )
             else
                 imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", collectionName );
             imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
-            videoPath = Utils::combinePath( imagePath, "medium_artwork", videoType_ );
         }
         else
         {
@@ -784,192 +990,160 @@ bool ScrollingList::allocateTexture( unsigned int index, Item *item )
             {
                 imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
                 imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
-                videoPath = Utils::combinePath( imagePath, "medium_artwork", videoType_ );
             }
             else
             {
                 config_.getMediaPropertyAbsolutePath( collectionName, imageType_, false, imagePath );
-                config_.getMediaPropertyAbsolutePath( collectionName, videoType_, false, videoPath );
-            }
-        }
-        if ( !t )
-        {
-            if ( videoType_ != "null" )
-            {
-                t = videoBuild.createVideo( videoPath, page, names[n], baseViewInfo.Monitor, false );
-            }
-            else
-            {
-                t = imageBuild.CreateImage( imagePath, page, names[n], baseViewInfo.Monitor );
             }
         }
+        if ( imageBuild.FindImage( imagePath, names[n], file ) ) return true;
 
         // check sub-collection path for art
-        if ( !t && !commonMode_ )
+        if ( !commonMode_ )
         {
             if ( layoutMode_ )
             {
                 imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", item->collectionInfo->name );
                 imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
-                videoPath = Utils::combinePath( imagePath, "medium_artwork", videoType_ );
             }
             else
             {
                 config_.getMediaPropertyAbsolutePath( item->collectionInfo->name, imageType_, false, imagePath );
-                config_.getMediaPropertyAbsolutePath( item->collectionInfo->name, videoType_, false, videoPath );
-            }
-            if ( videoType_ != "null" )
-            {
-                t = videoBuild.createVideo( videoPath, page, names[n], baseViewInfo.Monitor, false );
-            }
-            else
-            {
-                t = imageBuild.CreateImage( imagePath, page, names[n], baseViewInfo.Monitor );
             }
+            if ( imageBuild.FindImage( imagePath, names[n], file ) ) return true;
         }
     }
 
     // check collection path for art based on system name
-    if ( !t )
+    if ( layoutMode_ )
     {
-        if ( layoutMode_ )
-        {
-            if ( commonMode_ )
-                imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
-            else
-                imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", item->name );
-            imagePath = Utils::combinePath( imagePath, "system_artwork" );
-            videoPath = imagePath;
-        }
+        if ( commonMode_ )
+            imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
         else
+            imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", item->name );
+        imagePath = Utils::combinePath( imagePath, "system_artwork" );
+    }
+    else
+    {
+        if ( commonMode_ )
         {
-            if ( commonMode_ )
-            {
-                imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
-                imagePath = Utils::combinePath( imagePath, "system_artwork" );
-                videoPath = imagePath;
-            }
-            else
-            {
-                config_.getMediaPropertyAbsolutePath( item->name, imageType_, true, imagePath );
-                config_.getMediaPropertyAbsolutePath( item->name, videoType_, true, videoPath );
-            }
-        }
-        if ( videoType_ != "null" )
-        {
-            t = videoBuild.createVideo( videoPath, page, videoType_, baseViewInfo.Monitor, false );
+            imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
+            imagePath = Utils::combinePath( imagePath, "system_artwork" );
         }
         else
         {
-            t = imageBuild.CreateImage( imagePath, page, imageType_, baseViewInfo.Monitor );
+            config_.getMediaPropertyAbsolutePath( item->name, imageType_, true, imagePath );
         }
     }
+    if ( imageBuild.FindImage( imagePath, imageType_, file ) ) return true;
 
     // check rom directory path for art
-    if ( !t )
+    return imageBuild.FindImage( item->filepath, imageType_, file );
+}
+
+
+// The largest size, in screen pixels, an item is drawn at in any of the
+// scroll points. A side is 0 if it follows the image's aspect ratio, and
+// both are 0 if items are drawn at their native size.
+void ScrollingList::getThumbnailSize( int &width, int &height )
+{
+    width  = 0;
+    height = 0;
+
+    if ( !ThumbnailCache::isEnabled( ) || !scrollPoints_ ) return;
+
+    int   monitor      = baseViewInfo.Monitor;
+    int   layoutWidth  = page.getLayoutWidth( monitor );
+    int   layoutHeight = page.getLayoutHeight( monitor );
+    float scaleX       = (layoutWidth > 0)  ? static_cast<float>( SDL::getWindowWidth( monitor ) ) / layoutWidth : 1;
+    float scaleY       = (layoutHeight > 0) ? static_cast<float>( SDL::getWindowHeight( monitor ) ) / layoutHeight : 1;
+    float maxWidth     = 0;
+    float maxHeight    = 0;
+
+    for ( unsigned int i = 0; i < scrollPoints_->size( ); i++ )
     {
-        if ( videoType_ != "null" )
-        {
-            t = videoBuild.createVideo( item->filepath, page, videoType_, baseViewInfo.Monitor, false );
-        }
-        else
-        {
-            t = imageBuild.CreateImage( item->filepath, page, imageType_, baseViewInfo.Monitor );
-        }
+        ViewInfo *view = scrollPoints_->at( i );
+        float w = (view->Width >= 0)  ? view->Width  : view->MaxWidth;
+        float h = (view->Height >= 0) ? view->Height : view->MaxHeight;
+
+        if ( w >= FLT_MAX && h >= FLT_MAX ) return;
+
+        if ( w < FLT_MAX && w < view->MinWidth )  w = view->MinWidth;
+        if ( h < FLT_MAX && h < view->MinHeight ) h = view->MinHeight;
+        if ( w < FLT_MAX && w > maxWidth )  maxWidth  = w;
+        if ( h < FLT_MAX && h > maxHeight ) maxHeight = h;
     }
 
-    // Check for fallback art in case no video could be found
-    if ( videoType_ != "null" && !t)
+    width  = static_cast<int>( ceil( maxWidth * scaleX ) );
+    height = static_cast<int>( ceil( maxHeight * scaleY ) );
+}
+
+
+// Resolve and start decoding the art of the items that are about to scroll
+// into view. The look-ahead grows as the list accelerates so decoding keeps
+// up; one item is kept behind the list in case the direction reverses.
+void ScrollingList::prefetchTextures( bool forward )
+{
+    std::map<Item *, std::string> files;
+
+    if ( !ImageLoader::isEnabled( ) || videoType_ != "null" || prefetchTime_ <= 0 ||
+         !items_ || !scrollPoints_ || items_->size( ) <= scrollPoints_->size( ) )
     {
-        for ( unsigned int n = 0; n < names.size() && !t; ++n )
-        {
-            // check collection path for art
-            if ( layoutMode_ )
-            {
-                if ( commonMode_ )
-                    imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
-                else
-                    imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", collectionName );
-               imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
-            }
-            else
-            {
-                if ( commonMode_ )
-                {
-                    imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
-                    imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
-                }
-                else
-                {
-                    config_.getMediaPropertyAbsolutePath( collectionName, imageType_, false, imagePath );
-                }
-            }
+        prefetchFiles_.clear( );
+        return;
+    }
 
-            t = imageBuild.CreateImage( imagePath, page, names[n], baseViewInfo.Monitor );
+    unsigned int spare = items_->size( ) - scrollPoints_->size( );
+    unsigned int ahead = MAX_PREFETCH;
+    if ( scrollPeriod_ > 0 )
+    {
+        ahead = static_cast<unsigned int>( ceil( prefetchTime_ / scrollPeriod_ ) );
+    }
+    if ( ahead < 1 )            ahead = 1;
+    if ( ahead > MAX_PREFETCH ) ahead = MAX_PREFETCH;
+    if ( ahead > spare )        ahead = spare;
+    unsigned int behind = (spare > ahead) ? 1 : 0;
 
-            // check sub-collection path for art
-            if ( !t && !commonMode_ )
-            {
-                if ( layoutMode_ )
-                {
-                    imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", item->collectionInfo->name );
-                    imagePath = Utils::combinePath( imagePath, "medium_artwork", imageType_ );
-                }
-                else
-                {
-                    config_.getMediaPropertyAbsolutePath( item->collectionInfo->name, imageType_, false, imagePath );
-                }
-                t = imageBuild.CreateImage( imagePath, page, names[n], baseViewInfo.Monitor );
-            }
-        }
+    int thumbnailWidth;
+    int thumbnailHeight;
+    getThumbnailSize( thumbnailWidth, thumbnailHeight );
 
-        // check collection path for art based on system name
-        if ( !t )
+    for ( unsigned int i = 0; i < ahead + behind; i++ )
+    {
+        bool next = (i < ahead) ? forward : !forward;
+        unsigned int offset = (i < ahead) ? i : i - ahead;
+        Item *item;
+        if ( next )
+            item = items_->at( loopIncrement( itemIndex_, scrollPoints_->size( ) + offset, items_->size( ) ) );
+        else
+            item = items_->at( loopDecrement( itemIndex_, 1 + offset, items_->size( ) ) );
+
+        std::map<Item *, std::string>::iterator it = prefetchFiles_.find( item );
+        if ( it != prefetchFiles_.end( ) )
         {
-            if ( layoutMode_ )
-            {
-                if ( commonMode_ )
-                    imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
-                else
-                    imagePath = Utils::combinePath( Configuration::absolutePath, "layouts", layoutName, "collections", item->name );
-                imagePath = Utils::combinePath( imagePath, "system_artwork" );
-            }
-            else
+            files[item] = it->second;
+        }
+        else
+        {
+            std::string file;
+            if ( findImageFile( item, file ) )
             {
-                if ( commonMode_ )
+                std::string thumbnail = ThumbnailCache::getPath( file, thumbnailWidth, thumbnailHeight );
+                if ( thumbnail != "" )
                 {
-                    imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
-                    imagePath = Utils::combinePath( imagePath, "system_artwork" );
+                    if ( !TextureCache::contains( thumbnail, baseViewInfo.Monitor ) )
+                        ImageLoader::prefetch( thumbnail, file, thumbnailWidth, thumbnailHeight );
                 }
-                else
+                else if ( !TextureCache::contains( file, baseViewInfo.Monitor ) )
                 {
-                    config_.getMediaPropertyAbsolutePath( item->name, imageType_, true, imagePath );
+                    ImageLoader::prefetch( file );
                 }
             }
-            if ( !t )
-            {
-                t = imageBuild.CreateImage( imagePath, page, imageType_, baseViewInfo.Monitor );
-            }
+            files[item] = file;
         }
-        // check rom directory path for art
-        if ( !t )
-        {
-            t = imageBuild.CreateImage( item->filepath, page, imageType_, baseViewInfo.Monitor );
-        }
-
-    }
-
-    if ( !t )
-    {
-        t = new Text(item->title, page, fontInst_, baseViewInfo.Monitor );
     }
 
-    if ( t )
-    {
-        components_.at( index ) = t;
-    }
-
-    return true;
+    prefetchFiles_.swap( files );
 }
 
 
@@ -990,16 +1164,16 @@ void ScrollingList::draw(  )
 }
 
 
-void ScrollingList::draw( unsigned int layer )
+// Must be called once per frame before drawing the layers.
+void ScrollingList::updateLayers( )
 {
-    
-    if ( components_.size(  ) == 0 ) return;
+    layers_.update( components_ );
+}
 
-    for ( unsigned int i = 0; i < components_.size(  ); ++i )
-    {
-        Component *c = components_.at( i );
-        if ( c && c->baseViewInfo.Layer == layer ) c->draw(  );
-    }
+
+void ScrollingList::draw( unsigned int layer )
+{
+    layers_.draw( layer );
 }
 
 
@@ -1075,6 +1249,8 @@ void ScrollingList::scroll( bool forward )
         allocateTexture( loopDecrement( 0, 1, components_.size(  ) ), i );
     }
 
+    prefetchTextures( forward );
+
     // Set the animations
     for ( unsigned int i = 0; i < scrollPoints_->size(  ); i++ )
     {
@@ -1093,7 +1269,7 @@ void ScrollingList::scroll( bool forward )
 
         resetTweens( c, tweenPoints_->at( nextI ), scrollPoints_->at( i ), scrollPoints_->at( nextI ), scrollPeriod_ );
         c->baseViewInfo.font = scrollPoints_->at( nextI )->font; // Use the font settings of the next index
-        c->triggerEvent(  "menuScroll" );
+        c->triggerEvent(  EVENT_MENU_SCROLL );
     }
 
     // Reorder the components
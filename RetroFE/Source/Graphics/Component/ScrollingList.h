@@ -17,6 +17,7 @@
 
 
 #include <vector>
+#include <map>
 #include "Component.h"
 #include "../Animate/Tween.h"
 #include "../Page.h"
@@ -91,6 +92,7 @@ public:
     void freeGraphicsMemory( );
     void update( float dt );
     void draw( );
+    void updateLayers( );
     void draw( unsigned int layer );
     void setScrollAcceleration( float value );
     void setStartScrollTime( float value );
@@ -105,8 +107,17 @@ public:
 private:
 
     void resetTweens( Component *c, AnimationEvents *sets, ViewInfo *currentViewInfo, ViewInfo *nextViewInfo, double scrollTime );
+    static double getViewValue( ViewInfo *info, TweenProperty property );
     unsigned int loopIncrement( unsigned int offset, unsigned int i, unsigned int size );
     unsigned int loopDecrement( unsigned int offset, unsigned int i, unsigned int size );
+    void getArtNames( Item *item, std::vector<std::string> &names );
+    bool findImageFile( Item *item, std::string &file );
+    void getThumbnailSize( int &width, int &height );
+    void prefetchTextures( bool forward );
+
+    static const unsigned int MAX_PREFETCH = 16;
+    static const unsigned int NUM_SCROLL_PROPERTIES = 17;
+    static const TweenProperty scrollProperties_[NUM_SCROLL_PROPERTIES];
 
     bool layoutMode_;
     bool commonMode_;
@@ -127,8 +138,11 @@ private:
     std::string    layoutKey_;
     std::string    imageType_;
     std::string    videoType_;
+    float          prefetchTime_;
 
     std::vector<Item *>     *items_;
     std::vector<Component *> components_;
+    ComponentLayers          layers_;
+    std::map<Item *, std::string> prefetchFiles_;
 
 };
@@ -17,15 +17,29 @@
 
 #include "Text.h"
 #include "../../Utility/Log.h"
+#include "../../Utility/Utils.h"
 #include "../../SDL.h"
 #include "../Font.h"
 #include <sstream>
+#include <algorithm>
+#include <cmath>
 
 
 Text::Text( std::string text, Page &p, Font *font, int monitor )
     : Component(p)
     , textData_(text)
     , fontInst_(font)
+    , textIndexMax_(0)
+    , textWidth_(0)
+    , cache_(NULL)
+    , cacheWidth_(0)
+    , cacheHeight_(0)
+    , cacheScale_(1)
+    , cacheFont_(NULL)
+    , cacheFontSize_(0)
+    , cacheMaxWidth_(0)
+    , cacheMonitor_(0)
+    , cacheResets_(0)
 {
     allocateGraphicsMemory( );
     baseViewInfo.Monitor = monitor;
@@ -39,6 +53,8 @@ Text::~Text( )
 void Text::freeGraphicsMemory( )
 {
     Component::freeGraphicsMemory( );
+    freeCache( );
+    cacheFont_ = NULL;
 }
 
 void Text::allocateGraphicsMemory( )
@@ -72,10 +88,7 @@ void Text::draw( )
     else                     // If not, use the general font settings
       font = fontInst_;
 
-    SDL_Texture *t = font->getTexture( );
-
     float imageHeight = 0;
-    float imageWidth = 0;
     float imageMaxWidth = 0;
     if (baseViewInfo.Width < baseViewInfo.MaxWidth && baseViewInfo.Width > 0)
     {
@@ -89,30 +102,57 @@ void Text::draw( )
     imageHeight = (float)font->getHeight( );
     float scale = (float)baseViewInfo.FontSize / (float)imageHeight;
 
-    unsigned int textIndexMax = 0;
+    // The cached texture belongs to the renderer of the monitor it was drawn
+    // for, so a component moved to another monitor needs a new one
+    if ( cache_ && baseViewInfo.Monitor != cacheMonitor_ )
+    {
+        freeCache( );
+    }
 
-    // determine image width
-    for ( unsigned int i = 0; i < textData_.size( ); ++i )
+    bool changed = font != cacheFont_ || textData_ != cacheText_ || imageMaxWidth != cacheMaxWidth_ ||
+                   baseViewInfo.Monitor != cacheMonitor_ || SDL::getTargetResets( ) != cacheResets_;
+    if ( changed || baseViewInfo.FontSize != cacheFontSize_ )
     {
-        Font::GlyphInfo glyph;
-        if ( font->getRect( textData_[i], glyph ) )
+        if ( textData_ != cacheText_ )
         {
-            if ( glyph.minX < 0 )
-            {
-                imageWidth += glyph.minX;
-            }
+            Utils::decodeUtf8( textData_, codes_ );
+        }
+
+        // A new font size only needs the string redrawn if fewer or more
+        // characters fit now, or a distance field string moved to another
+        // scale step; in between the cached string is drawn scaled
+        unsigned int indexMax = textIndexMax_;
+        layout( font, scale, imageMaxWidth );
+        bool render = changed || textIndexMax_ != indexMax;
 
-            if ( (imageWidth + glyph.advance)*scale > imageMaxWidth )
+        bool cached = cache_ != NULL;
+        if ( font->hasDistanceFields( ) )
+        {
+            float distanceScale = getDistanceScale( scale );
+            if ( render || distanceScale != cacheScale_ )
             {
-                break;
+                float maxSize = getAnimatedMaximum( TWEEN_PROPERTY_FONT_SIZE, baseViewInfo.FontSize );
+                cached = renderDistanceCache( font, distanceScale, getDistanceScale( maxSize / imageHeight ) );
             }
-
-            textIndexMax = i;
-            imageWidth  += glyph.advance;
         }
-
+        else if ( render )
+        {
+            cached = renderCache( font );
+        }
+        if ( !cached )
+        {
+            freeCache( );
+        }
+        cacheText_     = textData_;
+        cacheFont_     = font;
+        cacheFontSize_ = baseViewInfo.FontSize;
+        cacheMaxWidth_ = imageMaxWidth;
+        cacheMonitor_  = baseViewInfo.Monitor;
+        cacheResets_   = SDL::getTargetResets( );
     }
 
+    float imageWidth = textWidth_;
+
     float oldWidth       = baseViewInfo.Width;
     float oldHeight      = baseViewInfo.Height;
     float oldImageWidth  = baseViewInfo.ImageHeight;
@@ -133,13 +173,26 @@ void Text::draw( )
 
 
     SDL_Rect rect;
+
+    // Draw the whole string as one quad
+    if ( cache_ )
+    {
+        rect.x = static_cast<int>( xOrigin - cacheOffsetX_ * scale );
+        rect.y = static_cast<int>( yOrigin - cacheOffsetY_ * scale );
+        rect.w = static_cast<int>( cacheRect_.w * scale / cacheScale_ );
+        rect.h = static_cast<int>( cacheRect_.h * scale / cacheScale_ );
+
+        SDL::renderCopy( cache_, baseViewInfo.Alpha, &cacheRect_, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor) );
+        return;
+    }
+
     rect.x = static_cast<int>( xOrigin );
 
-    for ( unsigned int i = 0; i <= textIndexMax; ++i )
+    for ( unsigned int i = 0; i <= textIndexMax_ && i < codes_.size( ); ++i )
     {
         Font::GlyphInfo glyph;
 
-        if ( font->getRect(textData_[i], glyph) && glyph.rect.h > 0 )
+        if ( font->getRect(codes_[i], glyph) && glyph.rect.h > 0 )
         {
             SDL_Rect charRect = glyph.rect;
             float h = static_cast<float>( charRect.h * scale );
@@ -158,10 +211,282 @@ void Text::draw( )
             }
 
 
-            SDL::renderCopy( t, baseViewInfo.Alpha, &charRect, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor) );
+            SDL::renderCopy( glyph.texture, baseViewInfo.Alpha, &charRect, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor) );
 
             rect.x += static_cast<int>( glyph.advance * scale );
 
         }
     }
 }
+
+
+// Determine how many characters fit within maxWidth, and their width
+void Text::layout( Font *font, float scale, float maxWidth )
+{
+    textIndexMax_ = 0;
+    textWidth_    = 0;
+
+    for ( unsigned int i = 0; i < codes_.size( ); ++i )
+    {
+        Font::GlyphInfo glyph;
+        if ( font->getRect( codes_[i], glyph ) )
+        {
+            if ( glyph.minX < 0 )
+            {
+                textWidth_ += glyph.minX;
+            }
+
+            if ( (textWidth_ + glyph.advance)*scale > maxWidth )
+            {
+                break;
+            }
+
+            textIndexMax_ = i;
+            textWidth_   += glyph.advance;
+        }
+
+    }
+}
+
+
+// Render the laid out glyphs, unscaled, into a target texture. Returns
+// false if the renderer cannot do so; the glyphs are then drawn one by one.
+bool Text::renderCache( Font *font )
+{
+    // This also rasterizes any missing glyphs before the target is switched
+    int minX;
+    int minY;
+    int maxX;
+    int maxY;
+    if ( !getExtent( font, minX, minY, maxX, maxY ) ) return false;
+
+    SDL_Renderer *renderer = SDL::getRenderer( baseViewInfo.Monitor );
+    if ( !SDL_RenderTargetSupported( renderer ) ) return false;
+
+    if ( !cache_ || cacheWidth_ < maxX - minX || cacheHeight_ < maxY - minY || font != cacheFont_ )
+    {
+        freeCache( );
+        cache_ = SDL_CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, maxX - minX, maxY - minY );
+        if ( !cache_ ) return false;
+        SDL_SetTextureBlendMode( cache_, SDL_BLENDMODE_BLEND );
+        cacheWidth_  = maxX - minX;
+        cacheHeight_ = maxY - minY;
+    }
+    cacheRect_.x  = 0;
+    cacheRect_.y  = 0;
+    cacheRect_.w  = maxX - minX;
+    cacheRect_.h  = maxY - minY;
+    cacheOffsetX_ = -minX;
+    cacheOffsetY_ = -minY;
+    cacheScale_   = 1;
+
+    // All glyphs have the font color, so copy the color and only blend the
+    // coverage; the transparent background has the font color too, so that
+    // filtering does not darken the edges when the string is scaled.
+    SDL_BlendMode copyColor = SDL_ComposeCustomBlendMode( SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ZERO, SDL_BLENDOPERATION_ADD,
+                                                          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD );
+    if ( !font->setBlendMode( copyColor ) )
+    {
+        font->setBlendMode( SDL_BLENDMODE_BLEND );
+        return false;
+    }
+
+    // Quads batched for the screen must be drawn before switching targets
+    SDL::flush( );
+    SDL_Texture *target = SDL_GetRenderTarget( renderer );
+    bool success = (SDL_SetRenderTarget( renderer, cache_ ) == 0);
+    if ( success )
+    {
+        SDL_Color color = font->getColor( );
+        SDL_SetRenderDrawColor( renderer, color.r, color.g, color.b, 0 );
+        SDL_RenderClear( renderer );
+
+        SDL_Rect rect;
+        rect.x = cacheOffsetX_;
+        for ( unsigned int i = 0; i <= textIndexMax_ && i < codes_.size( ); ++i )
+        {
+            Font::GlyphInfo glyph;
+            if ( font->getRect( codes_[i], glyph ) && glyph.rect.h > 0 )
+            {
+                if ( glyph.minX < 0 ) rect.x += glyph.minX;
+                rect.y = cacheOffsetY_;
+                if ( font->getAscent( ) < glyph.maxY )
+                {
+                    rect.y += font->getAscent( ) - glyph.maxY;
+                }
+                rect.w = glyph.rect.w;
+                rect.h = glyph.rect.h;
+                SDL_SetTextureAlphaMod( glyph.texture, 255 );
+                SDL_RenderCopy( renderer, glyph.texture, &glyph.rect, &rect );
+                rect.x += glyph.advance;
+            }
+        }
+        SDL_SetRenderTarget( renderer, target );
+    }
+    font->setBlendMode( SDL_BLENDMODE_BLEND );
+
+    return success;
+}
+
+
+// Render the laid out glyphs at scale from their distance fields, so that
+// text stays sharp however far its font size is tweened. The string is
+// built in memory; no render target is needed. The texture is made large
+// enough for maxScale, so a growing font size does not reallocate it.
+bool Text::renderDistanceCache( Font *font, float scale, float maxScale )
+{
+    int minX;
+    int minY;
+    int maxX;
+    int maxY;
+    if ( scale <= 0 || !getExtent( font, minX, minY, maxX, maxY ) ) return false;
+
+    int width  = static_cast<int>( ceil( (maxX - minX) * scale ) );
+    int height = static_cast<int>( ceil( (maxY - minY) * scale ) );
+    if ( width <= 0 || height <= 0 ) return false;
+
+    // Coverage is the distance to the outline in screen pixels, so edges
+    // are about a pixel wide at any scale
+    std::vector<Uint8> coverage( width * height, 0 );
+    int   spread   = Font::DISTANCE_SPREAD;
+    float toPixels = spread * scale / 128.0f;
+    int   x        = -minX;
+    for ( unsigned int i = 0; i <= textIndexMax_ && i < codes_.size( ); ++i )
+    {
+        Font::GlyphInfo     glyph;
+        Font::DistanceField field;
+        if ( !font->getRect( codes_[i], glyph ) || glyph.rect.h <= 0 ) continue;
+        if ( glyph.minX < 0 ) x += glyph.minX;
+        if ( font->getDistanceField( codes_[i], field ) )
+        {
+            int y = -minY;
+            if ( font->getAscent( ) < glyph.maxY )
+            {
+                y += font->getAscent( ) - glyph.maxY;
+            }
+            float fieldX = static_cast<float>( x - spread );
+            float fieldY = static_cast<float>( y - spread );
+
+            int x0 = std::max( 0, static_cast<int>( fieldX * scale ) );
+            int y0 = std::max( 0, static_cast<int>( fieldY * scale ) );
+            int x1 = std::min( width,  static_cast<int>( ceil( (fieldX + field.width) * scale ) ) );
+            int y1 = std::min( height, static_cast<int>( ceil( (fieldY + field.height) * scale ) ) );
+            for ( int py = y0; py < y1; ++py )
+            {
+                float fy = (py + 0.5f) / scale - fieldY - 0.5f;
+                int   iy = static_cast<int>( floor( fy ) );
+                float ty = fy - iy;
+                for ( int px = x0; px < x1; ++px )
+                {
+                    float fx = (px + 0.5f) / scale - fieldX - 0.5f;
+                    int   ix = static_cast<int>( floor( fx ) );
+                    float tx = fx - ix;
+
+                    // Bilinear sample; outside the field is as far out as it goes
+                    float d[4];
+                    for ( int j = 0; j < 4; ++j )
+                    {
+                        int sx = ix + (j & 1);
+                        int sy = iy + (j >> 1);
+                        d[j] = (sx < 0 || sy < 0 || sx >= field.width || sy >= field.height) ? 0.0f : field.distance[sy * field.width + sx];
+                    }
+                    float distance = (d[0] * (1 - tx) + d[1] * tx) * (1 - ty) + (d[2] * (1 - tx) + d[3] * tx) * ty;
+                    float alpha    = (distance - 128) * toPixels + 0.5f;
+                    if ( alpha <= 0 ) continue;
+
+                    Uint8 value = (alpha >= 1) ? 255 : static_cast<Uint8>( alpha * 255 );
+                    Uint8 &out  = coverage[py * width + px];
+                    if ( value > out ) out = value;
+                }
+            }
+        }
+        x += glyph.advance;
+    }
+
+    // The transparent pixels keep the font color, so that filtering does
+    // not darken the edges
+    SDL_Color color = font->getColor( );
+    Uint32 rgb = (color.r << 16) | (color.g << 8) | color.b;
+    std::vector<Uint32> pixels( width * height );
+    for ( int i = 0; i < width * height; ++i )
+    {
+        pixels[i] = (static_cast<Uint32>( coverage[i] ) << 24) | rgb;
+    }
+
+    SDL_Renderer *renderer = SDL::getRenderer( baseViewInfo.Monitor );
+    if ( !renderer ) return false;
+
+    if ( !cache_ || cacheWidth_ < width || cacheHeight_ < height || font != cacheFont_ )
+    {
+        freeCache( );
+        int textureWidth  = std::max( width,  static_cast<int>( ceil( (maxX - minX) * maxScale ) ) );
+        int textureHeight = std::max( height, static_cast<int>( ceil( (maxY - minY) * maxScale ) ) );
+        cache_ = SDL_CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, textureWidth, textureHeight );
+        if ( !cache_ ) return false;
+        SDL_SetTextureBlendMode( cache_, SDL_BLENDMODE_BLEND );
+        cacheWidth_  = textureWidth;
+        cacheHeight_ = textureHeight;
+    }
+    cacheRect_.x  = 0;
+    cacheRect_.y  = 0;
+    cacheRect_.w  = width;
+    cacheRect_.h  = height;
+    cacheOffsetX_ = -minX;
+    cacheOffsetY_ = -minY;
+    cacheScale_   = scale;
+
+    // Quads batched for the screen may still use the previous contents
+    SDL::flush( );
+    return SDL_UpdateTexture( cache_, &cacheRect_, &pixels[0], width * sizeof(Uint32) ) == 0;
+}
+
+
+// Round scale up to a power of 1.25, the scales distance field strings are
+// rendered at; drawing them slightly smaller keeps them sharp
+float Text::getDistanceScale( float scale )
+{
+    if ( scale <= 0 ) return scale;
+
+    const float step = 1.25f;
+    return static_cast<float>( pow( step, ceil( log( scale ) / log( step ) - 0.001f ) ) );
+}
+
+
+// Find the extent of the laid out glyphs, in font pixels; they can start
+// left of and above the origin
+bool Text::getExtent( Font *font, int &minX, int &minY, int &maxX, int &maxY )
+{
+    minX = 0;
+    minY = 0;
+    maxX = 0;
+    maxY = font->getHeight( );
+    int x = 0;
+    for ( unsigned int i = 0; i <= textIndexMax_ && i < codes_.size( ); ++i )
+    {
+        Font::GlyphInfo glyph;
+        if ( font->getRect( codes_[i], glyph ) && glyph.rect.h > 0 )
+        {
+            if ( glyph.minX < 0 ) x += glyph.minX;
+            int y = (font->getAscent( ) < glyph.maxY) ? font->getAscent( ) - glyph.maxY : 0;
+            minX  = std::min( minX, x );
+            minY  = std::min( minY, y );
+            maxX  = std::max( maxX, x + glyph.rect.w );
+            maxY  = std::max( maxY, y + glyph.rect.h );
+            x    += glyph.advance;
+        }
+    }
+
+    return maxX > minX;
+}
+
+
+void Text::freeCache( )
+{
+    if ( cache_ )
+    {
+        SDL_DestroyTexture( cache_ );
+        cache_ = NULL;
+    }
+    cacheWidth_  = 0;
+    cacheHeight_ = 0;
+}
@@ -39,6 +39,36 @@ public:
     void     draw( );
 
 private:
+    void     layout( Font *font, float scale, float maxWidth );
+    bool     renderCache( Font *font );
+    bool     renderDistanceCache( Font *font, float scale, float maxScale );
+    float    getDistanceScale( float scale );
+    bool     getExtent( Font *font, int &minX, int &minY, int &maxX, int &maxY );
+    void     freeCache( );
+
     std::string textData_;
     Font       *fontInst_;
+
+    // textData_ decoded from UTF-8
+    std::vector<unsigned int> codes_;
+
+    // Glyph layout of the string, in font pixels
+    unsigned int textIndexMax_;
+    float        textWidth_;
+
+    // The laid out string rendered to a single texture, and what it was
+    // rendered from; it is only redrawn when one of these changes
+    SDL_Texture *cache_;
+    int          cacheWidth_;
+    int          cacheHeight_;
+    SDL_Rect     cacheRect_;
+    float        cacheScale_;
+    int          cacheOffsetX_;
+    int          cacheOffsetY_;
+    std::string  cacheText_;
+    Font        *cacheFont_;
+    float        cacheFontSize_;
+    float        cacheMaxWidth_;
+    int          cacheMonitor_;
+    unsigned int cacheResets_;
 };
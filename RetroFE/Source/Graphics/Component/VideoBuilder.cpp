@@ -22,8 +22,34 @@
 
 
 VideoComponent * VideoBuilder::createVideo(std::string path, Page &page, std::string name, int monitor, bool isTypeVideo, int numLoops)
+{
+    std::string file;
+
+    if(findVideo(path, name, file))
+    {
+        return createVideo(file, page, monitor, isTypeVideo, numLoops);
+    }
+
+    return NULL;
+}
+
+
+VideoComponent * VideoBuilder::createVideo(std::string file, Page &page, int monitor, bool isTypeVideo, int numLoops)
 {
     VideoComponent *component = NULL;
+    IVideo *video = factory_.createVideo( monitor, isTypeVideo, numLoops, file );
+
+    if(video)
+    {
+        component = new VideoComponent(video, page, file);
+    }
+
+    return component;
+}
+
+
+bool VideoBuilder::findVideo(std::string path, std::string name, std::string &file)
+{
     std::vector<std::string> extensions;
 
     extensions.push_back("mp4");
@@ -40,18 +66,6 @@ VideoComponent * VideoBuilder::createVideo(std::string path, Page &page, std::st
     extensions.push_back("FLAC");
 
     std::string prefix = Utils::combinePath(path, name);
-    std::string file;
 
-    if(Utils::findMatchingFile(prefix, extensions, file))
-    {
-        IVideo *video = factory_.createVideo( monitor, isTypeVideo, numLoops );
-
-        if(video)
-        {
-            component = new VideoComponent(video, page, file);
-        }
-    }
-
-    return component;
+    return Utils::findMatchingFile(prefix, extensions, file);
 }
-
@@ -25,6 +25,8 @@ class VideoBuilder
 {
 public:
     VideoComponent * createVideo(std::string path, Page &page, std::string name, int monitor, bool isTypeVideo, int numLoops = -1);
+    VideoComponent * createVideo(std::string file, Page &page, int monitor, bool isTypeVideo, int numLoops = -1);
+    static bool findVideo(std::string path, std::string name, std::string &file);
 
 private:
     VideoFactory factory_;
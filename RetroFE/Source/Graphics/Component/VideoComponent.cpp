@@ -27,6 +27,7 @@ VideoComponent::VideoComponent(IVideo *videoInst, Page &p, std::string videoFile
     , videoFile_(videoFile)
     , videoInst_(videoInst)
     , isPlaying_(false)
+    , texture_(NULL)
 {
 //   AllocateGraphicsMemory();
 }
@@ -37,9 +38,7 @@ VideoComponent::~VideoComponent()
 
     if(videoInst_)
     {
-        videoInst_->stop();
-        if ( VideoFactory::canDelete( videoInst_ ) )
-            delete videoInst_;
+        VideoFactory::release( videoInst_ );
         videoInst_ = NULL;
     }
 }
@@ -53,6 +52,15 @@ void VideoComponent::update(float dt)
     if(isPlaying_)
     {
         videoInst_->setVolume(baseViewInfo.Volume);
+        videoInst_->setVisible(isVisible());
+
+        int layoutWidth  = page.getLayoutWidth(baseViewInfo.Monitor);
+        int layoutHeight = page.getLayoutHeight(baseViewInfo.Monitor);
+        if(layoutWidth > 0 && layoutHeight > 0)
+        {
+            videoInst_->setTargetSize(static_cast<int>(baseViewInfo.ScaledWidth() * SDL::getWindowWidth(baseViewInfo.Monitor) / layoutWidth),
+                                      static_cast<int>(baseViewInfo.ScaledHeight() * SDL::getWindowHeight(baseViewInfo.Monitor) / layoutHeight));
+        }
         videoInst_->update(dt);
 
         // video needs to run a frame to start getting size info
@@ -100,10 +108,40 @@ void VideoComponent::draw()
 
     if(texture)
     {
-        SDL::renderCopy(texture, baseViewInfo.Alpha, NULL, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
+        // only query the size when the video switches to a new texture
+        if(texture != texture_ || videoInst_->getTextureWidth() != textureRect_.w || videoInst_->getTextureHeight() != textureRect_.h)
+        {
+            texture_ = texture;
+            textureRect_.x = 0;
+            textureRect_.y = 0;
+            SDL_QueryTexture(texture_, NULL, NULL, &textureRect_.w, &textureRect_.h);
+        }
+        SDL::renderCopy(texture, baseViewInfo.Alpha, &textureRect_, &rect, baseViewInfo, page.getLayoutWidth(baseViewInfo.Monitor), page.getLayoutHeight(baseViewInfo.Monitor));
     }
 }
 
+// Whether the video can be seen at all; frames of hidden videos are not
+// uploaded. Rotated and reflected videos are assumed visible.
+bool VideoComponent::isVisible()
+{
+    if(baseViewInfo.Alpha <= 0)
+    {
+        return false;
+    }
+
+    float width  = baseViewInfo.ScaledWidth();
+    float height = baseViewInfo.ScaledHeight();
+    if(baseViewInfo.Angle != 0 || baseViewInfo.Reflection != "" || width <= 0 || height <= 0)
+    {
+        return true;
+    }
+
+    float x = baseViewInfo.XRelativeToOrigin();
+    float y = baseViewInfo.YRelativeToOrigin();
+    return x < page.getLayoutWidth(baseViewInfo.Monitor) && x + width > 0 &&
+           y < page.getLayoutHeight(baseViewInfo.Monitor) && y + height > 0;
+}
+
 bool VideoComponent::isPlaying()
 {
     return isPlaying_;
@@ -43,8 +43,12 @@ public:
     virtual bool isPaused( );
 
 private:
+    bool isVisible();
+
     std::string videoFile_;
     std::string name_;
     IVideo *videoInst_;
     bool isPlaying_;
+    SDL_Texture *texture_;
+    SDL_Rect textureRect_;
 };
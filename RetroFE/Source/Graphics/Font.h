@@ -16,9 +16,12 @@
 #pragma once
 
 #include <SDL2/SDL.h>
-#include <map>
 #include <string>
 
+class FontFace;
+
+// A font face drawn in one color on one monitor. Fonts that only differ
+// in color share the face, and so its rasterized glyphs.
 class Font
 {
 public:
@@ -30,30 +33,35 @@ public:
         int maxY;
         int advance;
         SDL_Rect rect;
+        SDL_Texture *texture;
+    };
+
+    // Signed distance to the glyph outline, in the same pixels as the glyph
+    // rect and padded by DISTANCE_SPREAD on every side. 128 is on the
+    // outline, 255 is DISTANCE_SPREAD pixels inside and 0 as far outside.
+    struct DistanceField
+    {
+        int width;
+        int height;
+        const Uint8 *distance;
     };
 
-    Font(std::string fontPath, int fontSize, SDL_Color color, int monitor);
+    static const int DISTANCE_SPREAD = 8;
+
+    Font(FontFace *face, SDL_Color color, int monitor);
     virtual ~Font();
     bool initialize();
     void deInitialize();
-    SDL_Texture *getTexture();
+    bool setBlendMode(SDL_BlendMode mode);
     bool getRect(unsigned int charCode, GlyphInfo &glyph);
+    bool hasDistanceFields();
+    bool getDistanceField(unsigned int charCode, DistanceField &field);
     int getHeight();
     int getAscent();
+    SDL_Color getColor();
 
 private:
-    struct GlyphInfoBuild
-    {
-        Font::GlyphInfo glyph;
-        SDL_Surface *surface;
-    };
-
-    SDL_Texture *texture;
-    int height;
-    int ascent;
-    std::map<unsigned int, GlyphInfoBuild *> atlas;
-    std::string fontPath_;
-    int fontSize_;
+    FontFace *face_;
     SDL_Color color_;
     int monitor_;
 };
@@ -16,13 +16,25 @@
 
 #include "FontCache.h"
 #include "Font.h"
+#include "../Database/Configuration.h"
 #include "../Utility/Log.h"
+#include "../Utility/Utils.h"
 #include "../SDL.h"
 #include <SDL2/SDL_ttf.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <cstdio>
 #include <sstream>
+#include <iomanip>
+
+#if defined(_WIN32) && !defined(__GNUC__)
+#include <windows.h>
+#endif
 
 //todo: memory leak when launching games
 FontCache::FontCache()
+    : distanceFields_(false)
 {
 }
 
@@ -33,12 +45,20 @@ FontCache::~FontCache()
 
 void FontCache::deInitialize()
 {
-    std::map<std::string, Font *>::iterator it = fontFaceMap_.begin();
-    while(it != fontFaceMap_.end())
+    std::map<std::string, Font *>::iterator it = fontMap_.begin();
+    while(it != fontMap_.end())
     {
         delete it->second;
-        fontFaceMap_.erase(it);
-        it = fontFaceMap_.begin();
+        fontMap_.erase(it);
+        it = fontMap_.begin();
+    }
+
+    std::map<std::string, FontFace *>::iterator faceIt = fontFaceMap_.begin();
+    while(faceIt != fontFaceMap_.end())
+    {
+        delete faceIt->second;
+        fontFaceMap_.erase(faceIt);
+        faceIt = fontFaceMap_.begin();
     }
 
     SDL_LockMutex(SDL::getMutex());
@@ -47,18 +67,48 @@ void FontCache::deInitialize()
 }
 
 
-void FontCache::initialize()
+void FontCache::initialize(Configuration &config)
 {
     //todo: make bool
     TTF_Init();
+
+    distanceFields_ = false;
+    config.getProperty("fontDistanceFields", distanceFields_);
+    if(!distanceFields_) return;
+
+    std::string cachePath = Utils::combinePath(Configuration::absolutePath, "cache");
+    fieldPath_ = Utils::combinePath(cachePath, "fonts");
+
+    std::string dirs[] = { cachePath, fieldPath_ };
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+#if defined(_WIN32) && !defined(__GNUC__)
+        CreateDirectory(dirs[i].c_str(), NULL);
+#elif defined(__MINGW32__)
+        mkdir(dirs[i].c_str());
+#else
+        mkdir(dirs[i].c_str(), 0755);
+#endif
+    }
+
+    struct stat sb;
+    if(stat(fieldPath_.c_str(), &sb) != 0)
+    {
+        Logger::write(Logger::ZONE_WARNING, "FontCache", "Could not create " + fieldPath_ + "; distance fields are not kept between runs");
+        return;
+    }
+
+    // Fields named by earlier builds used '-' as separator and a hash that
+    // differs between builds, so they can never be found again
+    removeFieldFiles("", "");
 }
-Font *FontCache::getFont(std::string fontPath, int fontSize, SDL_Color color)
+Font *FontCache::getFont(std::string fontPath, int fontSize, SDL_Color color, int monitor)
 {
     Font *t = NULL;
 
-    std::map<std::string, Font *>::iterator it = fontFaceMap_.find(buildFontKey(fontPath, fontSize, color));
+    std::map<std::string, Font *>::iterator it = fontMap_.find(buildFontKey(fontPath, fontSize, color, monitor));
 
-    if(it != fontFaceMap_.end())
+    if(it != fontMap_.end())
     {
         t = it->second;
     }
@@ -66,26 +116,104 @@ Font *FontCache::getFont(std::string fontPath, int fontSize, SDL_Color color)
     return t;
 }
 
-std::string FontCache::buildFontKey(std::string font, int fontSize, SDL_Color color)
+std::string FontCache::buildFaceKey(std::string font, int fontSize)
+{
+    std::stringstream ss;
+    ss << font << "_SIZE=" << fontSize;
+
+    return ss.str();
+}
+
+// Distance fields are stored per font file, named after a hash of its
+// path, its modification time and the field size. Fields of earlier
+// versions of the same font are deleted.
+std::string FontCache::buildFieldFile(std::string font)
 {
+    struct stat sb;
+    long long modified = (stat(font.c_str(), &sb) == 0) ? static_cast<long long>(sb.st_mtime) : 0;
+
+    // 64 bit FNV-1a; unlike std::hash it is the same in every build
+    unsigned long long hash = 14695981039346656037ULL;
+    for(unsigned int i = 0; i < font.size(); ++i)
+    {
+        hash ^= static_cast<unsigned char>(font[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    std::stringstream prefix;
+    prefix << std::hex << std::setw(16) << std::setfill('0') << hash << "_";
+
     std::stringstream ss;
-    ss << font << "_SIZE=" << fontSize << " RGB=" << color.r << "." << color.g << "." << color.b;
+    ss << prefix.str() << modified << "_" << DISTANCE_FIELD_FONT_SIZE << ".sdf";
+
+    removeFieldFiles(prefix.str(), ss.str());
+
+    return Utils::combinePath(fieldPath_, ss.str());
+}
+
+
+// Delete the field files starting with prefix other than keep, or with an
+// empty prefix the ones left behind by earlier builds
+void FontCache::removeFieldFiles(std::string prefix, std::string keep)
+{
+    DIR *dp = opendir(fieldPath_.c_str());
+    if(dp == NULL) return;
+
+    struct dirent *dirp;
+    while((dirp = readdir(dp)) != NULL)
+    {
+        std::string name = dirp->d_name;
+        if(name.size() < 4 || name.substr(name.size() - 4) != ".sdf" || name == keep)
+        {
+            continue;
+        }
+
+        bool remove = (prefix == "") ? name.size() > 16 && name[16] == '-'
+                                     : name.compare(0, prefix.size(), prefix) == 0;
+        if(remove)
+        {
+            std::remove(Utils::combinePath(fieldPath_, name).c_str());
+            Logger::write(Logger::ZONE_INFO, "FontCache", "Removed outdated distance fields " + name);
+        }
+    }
+    closedir(dp);
+}
+
+std::string FontCache::buildFontKey(std::string font, int fontSize, SDL_Color color, int monitor)
+{
+    std::stringstream ss;
+    ss << buildFaceKey(font, fontSize) << " RGB=" << (int)color.r << "." << (int)color.g << "." << (int)color.b << " MONITOR=" << monitor;
 
     return ss.str();
 }
 
+// The face is opened and rasterized once per file and size; each color
+// and monitor only adds a light Font referring to it
 bool FontCache::loadFont(std::string fontPath, int fontSize, SDL_Color color, int monitor)
 {
-    std::string key = buildFontKey(fontPath, fontSize, color);
-    std::map<std::string, Font *>::iterator it = fontFaceMap_.find(key);
+    std::string key = buildFontKey(fontPath, fontSize, color, monitor);
+    std::map<std::string, Font *>::iterator it = fontMap_.find(key);
 
-    if(it == fontFaceMap_.end())
+    if(it == fontMap_.end())
     {
-        Font *f = new Font(fontPath, fontSize, color, monitor);
-        f->initialize();
-        fontFaceMap_[key] = f;
+        int faceSize = distanceFields_ ? DISTANCE_FIELD_FONT_SIZE : fontSize;
+        std::string faceKey = buildFaceKey(fontPath, faceSize);
+        std::map<std::string, FontFace *>::iterator faceIt = fontFaceMap_.find(faceKey);
+
+        FontFace *face;
+        if(faceIt == fontFaceMap_.end())
+        {
+            face = new FontFace(fontPath, faceSize, distanceFields_ ? buildFieldFile(fontPath) : "");
+            face->initialize();
+            fontFaceMap_[faceKey] = face;
+        }
+        else
+        {
+            face = faceIt->second;
+        }
+
+        fontMap_[key] = new Font(face, color, monitor);
     }
 
     return true;
 }
-
@@ -16,22 +16,36 @@
 #pragma once
 
 #include "Font.h"
+#include "FontFace.h"
 #include <string>
 #include <map>
 
+class Configuration;
+
 class FontCache
 {
 public:
     FontCache();
-    void initialize();
+    void initialize(Configuration &config);
     void deInitialize();
     bool loadFont(std::string font, int fontSize, SDL_Color color, int monitor);
-    Font *getFont(std::string font, int fontSize, SDL_Color color);
+    Font *getFont(std::string font, int fontSize, SDL_Color color, int monitor);
 
     virtual ~FontCache();
 private:
-    std::map<std::string, Font *> fontFaceMap_;
-    std::string buildFontKey(std::string font, int fontSize, SDL_Color color);
+    std::map<std::string, FontFace *> fontFaceMap_;
+    std::map<std::string, Font *> fontMap_;
+    std::string buildFaceKey(std::string font, int fontSize);
+    std::string buildFieldFile(std::string font);
+    void removeFieldFiles(std::string prefix, std::string keep);
+
+    // Distance field faces are opened at this size whatever size is asked
+    // for; text is drawn sharp at any size from their fields
+    static const int DISTANCE_FIELD_FONT_SIZE = 64;
+
+    bool distanceFields_;
+    std::string fieldPath_;
+    std::string buildFontKey(std::string font, int fontSize, SDL_Color color, int monitor);
 
 };
 
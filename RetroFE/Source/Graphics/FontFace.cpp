@@ -0,0 +1,667 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FontFace.h"
+#include "../SDL.h"
+#include "../Utility/Log.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+static const char FIELD_FILE_MAGIC[8] = { 'R', 'F', 'E', 'S', 'D', 'F', '1', 0 };
+
+FontFace::FontFace(std::string fontPath, int fontSize, std::string fieldFile)
+    : font_(NULL)
+    , pageSize_(MIN_PAGE_SIZE)
+    , height(0)
+    , ascent(0)
+    , useCount_(0)
+    , fieldFile_(fieldFile)
+    , fieldsChanged_(false)
+    , fontPath_(fontPath)
+    , fontSize_(fontSize)
+{
+}
+
+FontFace::~FontFace()
+{
+    deInitialize();
+}
+
+int FontFace::getHeight()
+{
+    return height;
+}
+int FontFace::getAscent()
+{
+    return ascent;
+}
+
+bool FontFace::setBlendMode(int monitor, SDL_BlendMode mode)
+{
+    for(unsigned int i = 0; i < pages_.size(); ++i)
+    {
+        SDL_Texture *texture = getTexture(pages_[i], monitor);
+        if(!texture || SDL_SetTextureBlendMode(texture, mode) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The glyph is rasterized into the atlas on its first use, and the page
+// it is on is uploaded to the monitor's renderer if it is not there yet
+bool FontFace::getRect(unsigned int charCode, int monitor, Font::GlyphInfo &glyph)
+{
+    int index = findGlyph(charCode);
+    if(index < 0)
+    {
+        index = addGlyph(charCode);
+        if(index < 0) return false;
+    }
+
+    Glyph &found = glyphs_[index];
+    if(found.page < 0) return false;
+
+    AtlasPage &page = pages_[found.page];
+    glyph         = found.info;
+    glyph.texture = getTexture(page, monitor);
+    if(!glyph.texture) return false;
+
+    page.lastUsed = ++useCount_;
+
+    return true;
+}
+
+// Opening a face that is already open is harmless; components initialize
+// their fonts without knowing which other components share them
+bool FontFace::initialize()
+{
+    if(font_) return true;
+
+    font_ = TTF_OpenFont(fontPath_.c_str(), fontSize_);
+
+    if (!font_)
+    {
+        std::stringstream ss;
+        ss << "Could not open font: " << TTF_GetError();
+        Logger::write(Logger::ZONE_ERROR, "FontCache", ss.str());
+        return false;
+    }
+
+    height = TTF_FontHeight(font_);
+    ascent = TTF_FontAscent(font_);
+
+    // Make sure a page holds a good number of glyphs of this size
+    pageSize_ = MIN_PAGE_SIZE;
+    while(pageSize_ < height * 8 && pageSize_ < MAX_PAGE_SIZE)
+    {
+        pageSize_ *= 2;
+    }
+
+    if(fieldFile_ != "" && fields_.empty())
+    {
+        loadDistanceFields();
+    }
+
+    // Most text is ASCII, so have it ready
+    if(glyphs_.empty())
+    {
+        for(unsigned int i = 32; i < 128; ++i)
+        {
+            addGlyph(i);
+        }
+    }
+
+    return true;
+}
+
+
+void FontFace::deInitialize()
+{
+    if(fieldsChanged_)
+    {
+        saveDistanceFields();
+    }
+    fields_.clear();
+
+    freeTextures();
+
+    for(unsigned int i = 0; i < pages_.size(); ++i)
+    {
+        SDL_FreeSurface(pages_[i].surface);
+    }
+    pages_.clear();
+    glyphs_.clear();
+    table_.clear();
+
+    if(font_)
+    {
+        TTF_CloseFont(font_);
+        font_ = NULL;
+    }
+}
+
+
+// Release the textures but keep the rasterized pages, so that they only
+// have to be uploaded again when the renderers come back
+void FontFace::freeTextures()
+{
+    SDL_LockMutex(SDL::getMutex());
+    for(unsigned int i = 0; i < pages_.size(); ++i)
+    {
+        for(unsigned int j = 0; j < pages_[i].textures.size(); ++j)
+        {
+            if(pages_[i].textures[j])
+            {
+                SDL_DestroyTexture(pages_[i].textures[j]);
+            }
+        }
+        pages_[i].textures.clear();
+    }
+    SDL_UnlockMutex(SDL::getMutex());
+}
+
+
+SDL_Texture *FontFace::getTexture(AtlasPage &page, int monitor)
+{
+    if(monitor < 0) return NULL;
+
+    if(static_cast<unsigned int>(monitor) >= page.textures.size())
+    {
+        page.textures.resize(monitor + 1, NULL);
+    }
+
+    if(!page.textures[monitor])
+    {
+        SDL_Renderer *renderer = SDL::getRenderer(monitor);
+        if(!renderer) return NULL;
+
+        SDL_LockMutex(SDL::getMutex());
+        SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, pageSize_, pageSize_);
+        if(texture)
+        {
+            SDL_UpdateTexture(texture, NULL, page.surface->pixels, page.surface->pitch);
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        }
+        SDL_UnlockMutex(SDL::getMutex());
+
+        page.textures[monitor] = texture;
+    }
+
+    return page.textures[monitor];
+}
+
+
+int FontFace::findGlyph(unsigned int charCode)
+{
+    if(table_.empty()) return -1;
+
+    unsigned int mask = static_cast<unsigned int>(table_.size()) - 1;
+    for(unsigned int slot = (charCode * 2654435761u) & mask; table_[slot] >= 0; slot = (slot + 1) & mask)
+    {
+        if(glyphs_[table_[slot]].charCode == charCode)
+        {
+            return table_[slot];
+        }
+    }
+    return -1;
+}
+
+
+// Rasterize a glyph into the atlas. Glyphs the font does not provide are
+// remembered too, so they are only looked up once. Returns -1 if the font
+// is not loaded.
+int FontFace::addGlyph(unsigned int charCode)
+{
+    if(!font_) return -1;
+
+    Glyph glyph;
+    memset(&glyph, 0, sizeof(Glyph));
+    glyph.charCode = charCode;
+    glyph.page     = -1;
+
+    // Glyphs are white, so that any color can be applied by modulation
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface *surface = NULL;
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+    if(TTF_GlyphIsProvided32(font_, charCode))
+    {
+        surface = TTF_RenderGlyph32_Blended(font_, charCode, white);
+        TTF_GlyphMetrics32(font_, charCode,
+                &glyph.info.minX, &glyph.info.maxX,
+                &glyph.info.minY, &glyph.info.maxY,
+                &glyph.info.advance);
+    }
+#else
+    if(charCode <= 0xFFFF && TTF_GlyphIsProvided(font_, static_cast<Uint16>(charCode)))
+    {
+        surface = TTF_RenderGlyph_Blended(font_, static_cast<Uint16>(charCode), white);
+        TTF_GlyphMetrics(font_, static_cast<Uint16>(charCode),
+                &glyph.info.minX, &glyph.info.maxX,
+                &glyph.info.minY, &glyph.info.maxY,
+                &glyph.info.advance);
+    }
+#endif
+
+    if(surface && placeGlyph(surface->w, surface->h, glyph.page, glyph.info.rect))
+    {
+        AtlasPage &page = pages_[glyph.page];
+
+        // Copy the coverage as is rather than blending it onto the page
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+        SDL_Rect rect = glyph.info.rect;
+        SDL_BlitSurface(surface, NULL, page.surface, &rect);
+
+        const Uint8 *pixels = static_cast<Uint8 *>(page.surface->pixels) + glyph.info.rect.y * page.surface->pitch + glyph.info.rect.x * 4;
+        SDL_LockMutex(SDL::getMutex());
+        for(unsigned int i = 0; i < page.textures.size(); ++i)
+        {
+            if(page.textures[i])
+            {
+                SDL_UpdateTexture(page.textures[i], &glyph.info.rect, pixels, page.surface->pitch);
+            }
+        }
+        SDL_UnlockMutex(SDL::getMutex());
+    }
+    if(surface)
+    {
+        SDL_FreeSurface(surface);
+    }
+
+    glyphs_.push_back(glyph);
+    if(glyphs_.size() * 2 > table_.size())
+    {
+        rebuildTable();
+    }
+    else
+    {
+        unsigned int mask = static_cast<unsigned int>(table_.size()) - 1;
+        unsigned int slot = (charCode * 2654435761u) & mask;
+        while(table_[slot] >= 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        table_[slot] = static_cast<int>(glyphs_.size()) - 1;
+    }
+
+    return static_cast<int>(glyphs_.size()) - 1;
+}
+
+
+// Find room for a glyph, adding a page or evicting the least recently used
+// one when all pages are full
+bool FontFace::placeGlyph(int w, int h, int &page, SDL_Rect &rect)
+{
+    if(w > pageSize_ || h > pageSize_) return false;
+
+    for(unsigned int i = 0; i < pages_.size(); ++i)
+    {
+        if(placeGlyph(pages_[i], w, h, rect))
+        {
+            page = i;
+            return true;
+        }
+    }
+
+    if(pages_.size() < MAX_PAGES)
+    {
+        AtlasPage atlasPage;
+        atlasPage.surface  = SDL_CreateRGBSurfaceWithFormat(0, pageSize_, pageSize_, 32, SDL_PIXELFORMAT_ARGB8888);
+        atlasPage.height   = 0;
+        atlasPage.lastUsed = useCount_;
+        if(!atlasPage.surface) return false;
+
+        SDL_FillRect(atlasPage.surface, NULL, 0);
+        pages_.push_back(atlasPage);
+        page = static_cast<int>(pages_.size()) - 1;
+    }
+    else
+    {
+        page = 0;
+        for(unsigned int i = 1; i < pages_.size(); ++i)
+        {
+            if(pages_[i].lastUsed < pages_[page].lastUsed)
+            {
+                page = i;
+            }
+        }
+        evictPage(page);
+    }
+
+    return placeGlyph(pages_[page], w, h, rect);
+}
+
+
+// Shelf packing: put the glyph on the lowest shelf it fits on, or open a
+// new shelf. Glyphs are kept a pixel apart so that filtering does not
+// pick up their neighbours.
+bool FontFace::placeGlyph(AtlasPage &page, int w, int h, SDL_Rect &rect)
+{
+    Shelf *best = NULL;
+    for(unsigned int i = 0; i < page.shelves.size(); ++i)
+    {
+        Shelf &shelf = page.shelves[i];
+        if(shelf.height >= h && shelf.x + w <= pageSize_ && (!best || shelf.height < best->height))
+        {
+            best = &shelf;
+        }
+    }
+
+    if(!best)
+    {
+        if(page.height + h > pageSize_) return false;
+
+        Shelf shelf;
+        shelf.y      = page.height;
+        shelf.height = h;
+        shelf.x      = 0;
+        page.shelves.push_back(shelf);
+        page.height += h + 1;
+        best = &page.shelves.back();
+    }
+
+    rect.x   = best->x;
+    rect.y   = best->y;
+    rect.w   = w;
+    rect.h   = h;
+    best->x += w + 1;
+
+    return true;
+}
+
+
+// Drop all glyphs of a page and clear it for reuse
+void FontFace::evictPage(int page)
+{
+    // Quads drawn from this page may still be waiting to be submitted
+    SDL::flush();
+
+    std::vector<Glyph> glyphs;
+    for(unsigned int i = 0; i < glyphs_.size(); ++i)
+    {
+        if(glyphs_[i].page != page)
+        {
+            glyphs.push_back(glyphs_[i]);
+        }
+    }
+    glyphs_.swap(glyphs);
+    rebuildTable();
+
+    AtlasPage &atlasPage = pages_[page];
+    SDL_FillRect(atlasPage.surface, NULL, 0);
+    SDL_LockMutex(SDL::getMutex());
+    for(unsigned int i = 0; i < atlasPage.textures.size(); ++i)
+    {
+        if(atlasPage.textures[i])
+        {
+            SDL_UpdateTexture(atlasPage.textures[i], NULL, atlasPage.surface->pixels, atlasPage.surface->pitch);
+        }
+    }
+    SDL_UnlockMutex(SDL::getMutex());
+    atlasPage.shelves.clear();
+    atlasPage.height   = 0;
+    atlasPage.lastUsed = useCount_;
+}
+
+
+void FontFace::rebuildTable()
+{
+    unsigned int size = 256;
+    while(size < glyphs_.size() * 2)
+    {
+        size *= 2;
+    }
+    table_.assign(size, -1);
+
+    unsigned int mask = size - 1;
+    for(unsigned int i = 0; i < glyphs_.size(); ++i)
+    {
+        unsigned int slot = (glyphs_[i].charCode * 2654435761u) & mask;
+        while(table_[slot] >= 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        table_[slot] = i;
+    }
+}
+
+
+bool FontFace::hasDistanceFields()
+{
+    return fieldFile_ != "";
+}
+
+
+// Distance fields are built from the rasterized glyph the first time they
+// are asked for; the returned pixels stay valid until the face is closed
+bool FontFace::getDistanceField(unsigned int charCode, Font::DistanceField &field)
+{
+    if(fieldFile_ == "") return false;
+
+    std::map<unsigned int, DistanceGlyph>::iterator it = fields_.find(charCode);
+    if(it == fields_.end())
+    {
+        int index = findGlyph(charCode);
+        if(index < 0)
+        {
+            index = addGlyph(charCode);
+            if(index < 0) return false;
+        }
+
+        DistanceGlyph distanceGlyph;
+        if(!buildDistanceField(glyphs_[index], distanceGlyph)) return false;
+
+        it = fields_.insert(std::make_pair(charCode, distanceGlyph)).first;
+        fieldsChanged_ = true;
+    }
+
+    field.width    = it->second.width;
+    field.height   = it->second.height;
+    field.distance = &it->second.distance[0];
+
+    return true;
+}
+
+
+// Squared euclidean distance transform of one row or column, after
+// Felzenszwalb and Huttenlocher
+static void distanceTransform(std::vector<float> &f, int n, std::vector<float> &d, std::vector<int> &v, std::vector<float> &z)
+{
+    int k = 0;
+    v[0] = 0;
+    z[0] = -HUGE_VALF;
+    z[1] = HUGE_VALF;
+    for(int q = 1; q < n; ++q)
+    {
+        float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+        while(s <= z[k])
+        {
+            --k;
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+        }
+        ++k;
+        v[k]     = q;
+        z[k]     = s;
+        z[k + 1] = HUGE_VALF;
+    }
+
+    k = 0;
+    for(int q = 0; q < n; ++q)
+    {
+        while(z[k + 1] < q) ++k;
+        d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+}
+
+
+// Distance from every pixel to the nearest pixel that is set in the mask
+static void distanceTransform(const std::vector<bool> &mask, int width, int height, std::vector<float> &distance)
+{
+    int n = std::max(width, height);
+    std::vector<float> f(n);
+    std::vector<float> d(n);
+    std::vector<int>   v(n);
+    std::vector<float> z(n + 1);
+
+    distance.resize(width * height);
+    for(int i = 0; i < width * height; ++i)
+    {
+        distance[i] = mask[i] ? 0 : 1e20f;
+    }
+
+    for(int x = 0; x < width; ++x)
+    {
+        for(int y = 0; y < height; ++y) f[y] = distance[y * width + x];
+        distanceTransform(f, height, d, v, z);
+        for(int y = 0; y < height; ++y) distance[y * width + x] = d[y];
+    }
+    for(int y = 0; y < height; ++y)
+    {
+        for(int x = 0; x < width; ++x) f[x] = distance[y * width + x];
+        distanceTransform(f, width, d, v, z);
+        for(int x = 0; x < width; ++x) distance[y * width + x] = std::sqrt(d[x]);
+    }
+}
+
+
+bool FontFace::buildDistanceField(const Glyph &glyph, DistanceGlyph &field)
+{
+    if(glyph.page < 0 || glyph.info.rect.w <= 0 || glyph.info.rect.h <= 0) return false;
+
+    const SDL_Surface *surface = pages_[glyph.page].surface;
+    const SDL_Rect    &rect    = glyph.info.rect;
+    int spread = Font::DISTANCE_SPREAD;
+
+    field.width  = rect.w + 2 * spread;
+    field.height = rect.h + 2 * spread;
+
+    int size = field.width * field.height;
+    std::vector<Uint8> coverage(size, 0);
+    for(int y = 0; y < rect.h; ++y)
+    {
+        const Uint32 *in = reinterpret_cast<const Uint32 *>(static_cast<const Uint8 *>(surface->pixels) + (rect.y + y) * surface->pitch) + rect.x;
+        for(int x = 0; x < rect.w; ++x)
+        {
+            coverage[(y + spread) * field.width + x + spread] = static_cast<Uint8>(in[x] >> 24);
+        }
+    }
+
+    std::vector<bool> inside(size);
+    std::vector<bool> outside(size);
+    for(int i = 0; i < size; ++i)
+    {
+        inside[i]  = coverage[i] >= 128;
+        outside[i] = !inside[i];
+    }
+
+    std::vector<float> toInside;
+    std::vector<float> toOutside;
+    distanceTransform(inside, field.width, field.height, toInside);
+    distanceTransform(outside, field.width, field.height, toOutside);
+
+    // Pixel centers are half a pixel from the edge between them; partly
+    // covered pixels know their distance to the outline more precisely
+    field.distance.resize(size);
+    for(int i = 0; i < size; ++i)
+    {
+        float d;
+        if(coverage[i] > 0 && coverage[i] < 255)
+            d = coverage[i] / 255.0f - 0.5f;
+        else if(inside[i])
+            d = toOutside[i] - 0.5f;
+        else
+            d = 0.5f - toInside[i];
+
+        float value = 128 + d * 128 / spread;
+        field.distance[i] = static_cast<Uint8>(std::min(255.0f, std::max(0.0f, value + 0.5f)));
+    }
+
+    return true;
+}
+
+
+void FontFace::loadDistanceFields()
+{
+    FILE *file = fopen(fieldFile_.c_str(), "rb");
+    if(!file) return;
+
+    char magic[sizeof(FIELD_FILE_MAGIC)];
+    int  spread = 0;
+    if(fread(magic, sizeof(magic), 1, file) != 1 || memcmp(magic, FIELD_FILE_MAGIC, sizeof(magic)) != 0 ||
+       fread(&spread, sizeof(spread), 1, file) != 1 || spread != Font::DISTANCE_SPREAD)
+    {
+        fclose(file);
+        return;
+    }
+
+    Uint32 header[3];
+    while(fread(header, sizeof(header), 1, file) == 1)
+    {
+        DistanceGlyph field;
+        field.width  = header[1];
+        field.height = header[2];
+        if(field.width <= 0 || field.height <= 0 || field.width > MAX_PAGE_SIZE || field.height > MAX_PAGE_SIZE) break;
+
+        field.distance.resize(field.width * field.height);
+        if(fread(&field.distance[0], field.distance.size(), 1, file) != 1) break;
+
+        fields_[header[0]] = field;
+    }
+    fclose(file);
+
+    std::stringstream ss;
+    ss << "Loaded " << fields_.size() << " distance fields for " << fontPath_;
+    Logger::write(Logger::ZONE_DEBUG, "FontCache", ss.str());
+}
+
+
+void FontFace::saveDistanceFields()
+{
+    // Write to a temporary file first so a half written file is never loaded
+    std::string temp = fieldFile_ + ".tmp";
+    FILE *file = fopen(temp.c_str(), "wb");
+    if(!file)
+    {
+        Logger::write(Logger::ZONE_WARNING, "FontCache", "Could not write " + fieldFile_);
+        return;
+    }
+
+    int  spread  = Font::DISTANCE_SPREAD;
+    bool success = fwrite(FIELD_FILE_MAGIC, sizeof(FIELD_FILE_MAGIC), 1, file) == 1 &&
+                   fwrite(&spread, sizeof(spread), 1, file) == 1;
+    for(std::map<unsigned int, DistanceGlyph>::iterator it = fields_.begin(); success && it != fields_.end(); ++it)
+    {
+        Uint32 header[3] = { it->first, static_cast<Uint32>(it->second.width), static_cast<Uint32>(it->second.height) };
+        success = fwrite(header, sizeof(header), 1, file) == 1 &&
+                  fwrite(&it->second.distance[0], it->second.distance.size(), 1, file) == 1;
+    }
+    success = (fclose(file) == 0) && success;
+
+    std::remove(fieldFile_.c_str());
+    if(!success || std::rename(temp.c_str(), fieldFile_.c_str()) != 0)
+    {
+        Logger::write(Logger::ZONE_WARNING, "FontCache", "Could not write " + fieldFile_);
+        std::remove(temp.c_str());
+        return;
+    }
+    fieldsChanged_ = false;
+}
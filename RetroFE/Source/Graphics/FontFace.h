@@ -0,0 +1,106 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "Font.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <string>
+#include <map>
+#include <vector>
+
+// A TTF file opened at one size. Glyphs are rasterized in white on first
+// use into atlas pages kept in memory, and each page is uploaded once to
+// every renderer that draws from it. Fonts of any color share the face;
+// they tint the glyphs when they are drawn.
+//
+// Given a field file, the face also provides signed distance fields of its
+// glyphs, which are kept in that file between runs.
+class FontFace
+{
+public:
+    FontFace(std::string fontPath, int fontSize, std::string fieldFile = "");
+    virtual ~FontFace();
+    bool initialize();
+    void deInitialize();
+    void freeTextures();
+    bool setBlendMode(int monitor, SDL_BlendMode mode);
+    bool getRect(unsigned int charCode, int monitor, Font::GlyphInfo &glyph);
+    bool hasDistanceFields();
+    bool getDistanceField(unsigned int charCode, Font::DistanceField &field);
+    int getHeight();
+    int getAscent();
+
+private:
+    struct Shelf
+    {
+        int y;
+        int height;
+        int x;
+    };
+
+    struct AtlasPage
+    {
+        SDL_Surface                *surface;
+        std::vector<SDL_Texture *>  textures;   // per monitor, created on first use
+        std::vector<Shelf>          shelves;
+        int                         height;
+        unsigned int                lastUsed;
+    };
+
+    struct Glyph
+    {
+        unsigned int    charCode;
+        int             page;      // -1 if the font does not provide the glyph
+        Font::GlyphInfo info;
+    };
+
+    struct DistanceGlyph
+    {
+        int                width;
+        int                height;
+        std::vector<Uint8> distance;
+    };
+
+    int  findGlyph(unsigned int charCode);
+    int  addGlyph(unsigned int charCode);
+    bool placeGlyph(int w, int h, int &page, SDL_Rect &rect);
+    bool placeGlyph(AtlasPage &page, int w, int h, SDL_Rect &rect);
+    SDL_Texture *getTexture(AtlasPage &page, int monitor);
+    void evictPage(int page);
+    void rebuildTable();
+    bool buildDistanceField(const Glyph &glyph, DistanceGlyph &field);
+    void loadDistanceFields();
+    void saveDistanceFields();
+
+    static const int          MIN_PAGE_SIZE = 512;
+    static const int          MAX_PAGE_SIZE = 4096;
+    static const unsigned int MAX_PAGES     = 8;
+
+    TTF_Font *font_;
+    int pageSize_;
+    int height;
+    int ascent;
+    std::vector<AtlasPage> pages_;
+    std::vector<Glyph>     glyphs_;
+    std::vector<int>       table_;   // open addressing hash of indexes into glyphs_
+    unsigned int           useCount_;
+    std::map<unsigned int, DistanceGlyph> fields_;
+    std::string fieldFile_;
+    bool fieldsChanged_;
+    std::string fontPath_;
+    int fontSize_;
+};
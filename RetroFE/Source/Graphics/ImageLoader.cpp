@@ -0,0 +1,302 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ImageLoader.h"
+#include "ThumbnailCache.h"
+#include "../Database/Configuration.h"
+#include "../Utility/Log.h"
+#include <SDL2/SDL_image.h>
+
+std::vector<SDL_Thread *>                 ImageLoader::threads_;
+SDL_mutex                                *ImageLoader::mutex_   = NULL;
+SDL_cond                                 *ImageLoader::cond_    = NULL;
+std::map<std::string, ImageLoader::Entry> ImageLoader::entries_;
+std::list<std::string>                    ImageLoader::queue_;
+std::list<std::string>                    ImageLoader::prefetched_;
+bool                                      ImageLoader::running_ = false;
+
+
+bool ImageLoader::initialize( Configuration &config )
+{
+    int numThreads = 2;
+    config.getProperty( "imageLoadThreads", numThreads );
+
+    if ( numThreads <= 0 )
+    {
+        Logger::write( Logger::ZONE_INFO, "ImageLoader", "Background image decoding disabled" );
+        return true;
+    }
+
+    mutex_ = SDL_CreateMutex( );
+    cond_  = SDL_CreateCond( );
+    if ( !mutex_ || !cond_ )
+    {
+        std::string error = SDL_GetError( );
+        Logger::write( Logger::ZONE_ERROR, "ImageLoader", "Mutex creation failed: " + error );
+        deInitialize( );
+        return false;
+    }
+
+    running_ = true;
+    for ( int i = 0; i < numThreads; ++i )
+    {
+        SDL_Thread *thread = SDL_CreateThread( worker, "ImageLoader", NULL );
+        if ( !thread )
+        {
+            std::string error = SDL_GetError( );
+            Logger::write( Logger::ZONE_WARNING, "ImageLoader", "Could not create decode thread: " + error );
+            break;
+        }
+        threads_.push_back( thread );
+    }
+
+    if ( threads_.size( ) == 0 )
+    {
+        deInitialize( );
+        return false;
+    }
+
+    Logger::write( Logger::ZONE_INFO, "ImageLoader", "Started " + std::to_string( threads_.size( ) ) + " image decode thread(s)" );
+
+    return true;
+}
+
+
+void ImageLoader::deInitialize( )
+{
+    if ( mutex_ )
+    {
+        SDL_LockMutex( mutex_ );
+        running_ = false;
+        SDL_CondBroadcast( cond_ );
+        SDL_UnlockMutex( mutex_ );
+    }
+
+    for ( unsigned int i = 0; i < threads_.size( ); ++i )
+    {
+        SDL_WaitThread( threads_[i], NULL );
+    }
+    threads_.clear( );
+
+    for ( std::map<std::string, Entry>::iterator it = entries_.begin( ); it != entries_.end( ); ++it )
+    {
+        if ( it->second.surface )
+        {
+            SDL_FreeSurface( it->second.surface );
+        }
+    }
+    entries_.clear( );
+    queue_.clear( );
+    prefetched_.clear( );
+
+    if ( cond_ )
+    {
+        SDL_DestroyCond( cond_ );
+        cond_ = NULL;
+    }
+    if ( mutex_ )
+    {
+        SDL_DestroyMutex( mutex_ );
+        mutex_ = NULL;
+    }
+}
+
+
+bool ImageLoader::isEnabled( )
+{
+    return running_;
+}
+
+
+// Queue a file for decoding; every request must be matched by a release.
+// Requests are decoded ahead of any outstanding prefetches.
+void ImageLoader::request( std::string file, std::string source, int width, int height )
+{
+    if ( !running_ ) return;
+
+    SDL_LockMutex( mutex_ );
+    std::map<std::string, Entry>::iterator it = entries_.find( file );
+    if ( it == entries_.end( ) )
+    {
+        Entry entry;
+        entry.surface   = NULL;
+        entry.refCount  = 1;
+        entry.decoded   = false;
+        entry.source    = source;
+        entry.width     = width;
+        entry.height    = height;
+        entries_[file] = entry;
+        queue_.push_front( file );
+        SDL_CondSignal( cond_ );
+    }
+    else
+    {
+        // Claim a prefetched file, moving it up the queue if it is still waiting
+        if ( it->second.refCount++ == 0 )
+        {
+            prefetched_.remove( file );
+            if ( !it->second.decoded )
+            {
+                queue_.remove( file );
+                queue_.push_front( file );
+            }
+        }
+    }
+    SDL_UnlockMutex( mutex_ );
+}
+
+
+// Decode a file that is likely to be requested soon. Unclaimed prefetches
+// are dropped oldest first once more than MAX_PREFETCHED are held.
+void ImageLoader::prefetch( std::string file, std::string source, int width, int height )
+{
+    if ( !running_ ) return;
+
+    SDL_LockMutex( mutex_ );
+    if ( entries_.find( file ) == entries_.end( ) )
+    {
+        Entry entry;
+        entry.surface   = NULL;
+        entry.refCount  = 0;
+        entry.decoded   = false;
+        entry.source    = source;
+        entry.width     = width;
+        entry.height    = height;
+        entries_[file] = entry;
+        queue_.push_back( file );
+        prefetched_.push_back( file );
+        SDL_CondSignal( cond_ );
+
+        while ( prefetched_.size( ) > MAX_PREFETCHED )
+        {
+            std::string oldest = prefetched_.front( );
+            prefetched_.pop_front( );
+
+            std::map<std::string, Entry>::iterator it = entries_.find( oldest );
+            if ( it != entries_.end( ) && it->second.refCount == 0 )
+            {
+                if ( it->second.surface )
+                {
+                    SDL_FreeSurface( it->second.surface );
+                }
+                entries_.erase( it );
+                queue_.remove( oldest );
+            }
+        }
+    }
+    SDL_UnlockMutex( mutex_ );
+}
+
+
+// Returns true once the file has been decoded. The surface is NULL if the
+// file could not be loaded, and stays owned by the loader.
+bool ImageLoader::poll( std::string file, SDL_Surface *&surface )
+{
+    bool decoded = false;
+    surface      = NULL;
+
+    if ( !running_ ) return true;
+
+    SDL_LockMutex( mutex_ );
+    std::map<std::string, Entry>::iterator it = entries_.find( file );
+    if ( it != entries_.end( ) && it->second.decoded )
+    {
+        surface = it->second.surface;
+        decoded = true;
+    }
+    SDL_UnlockMutex( mutex_ );
+
+    return decoded;
+}
+
+
+void ImageLoader::release( std::string file )
+{
+    if ( !running_ ) return;
+
+    SDL_LockMutex( mutex_ );
+    std::map<std::string, Entry>::iterator it = entries_.find( file );
+    if ( it != entries_.end( ) && --it->second.refCount <= 0 )
+    {
+        if ( it->second.surface )
+        {
+            SDL_FreeSurface( it->second.surface );
+        }
+        entries_.erase( it );
+        queue_.remove( file );
+    }
+    SDL_UnlockMutex( mutex_ );
+}
+
+
+int ImageLoader::worker( void * )
+{
+    SDL_LockMutex( mutex_ );
+    while ( running_ )
+    {
+        if ( queue_.empty( ) )
+        {
+            SDL_CondWait( cond_, mutex_ );
+            continue;
+        }
+
+        std::string file = queue_.front( );
+        queue_.pop_front( );
+
+        std::map<std::string, Entry>::iterator it = entries_.find( file );
+        if ( it == entries_.end( ) || it->second.decoded )
+        {
+            continue;
+        }
+        Entry entry = it->second;
+
+        SDL_UnlockMutex( mutex_ );
+        SDL_Surface *surface = IMG_Load( file.c_str( ) );
+        if ( !surface && entry.source != "" )
+        {
+            // first use of this thumbnail; build it from the full image
+            surface = IMG_Load( entry.source.c_str( ) );
+            if ( surface )
+            {
+                SDL_Surface *thumbnail = ThumbnailCache::create( surface, file, entry.width, entry.height );
+                if ( thumbnail )
+                {
+                    SDL_FreeSurface( surface );
+                    surface = thumbnail;
+                }
+            }
+        }
+        SDL_LockMutex( mutex_ );
+
+        // The request may have been released while we were decoding
+        it = entries_.find( file );
+        if ( it == entries_.end( ) || it->second.decoded )
+        {
+            if ( surface )
+            {
+                SDL_FreeSurface( surface );
+            }
+        }
+        else
+        {
+            it->second.surface = surface;
+            it->second.decoded = true;
+        }
+    }
+    SDL_UnlockMutex( mutex_ );
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <list>
+#include <map>
+#include <vector>
+
+class Configuration;
+
+// Decodes image files into surfaces on a pool of background threads. The
+// render thread only has to turn a finished surface into a texture. A file
+// can name a thumbnail; if it does not exist yet it is built from source.
+class ImageLoader
+{
+public:
+    static bool initialize( Configuration &config );
+    static void deInitialize( );
+    static bool isEnabled( );
+    static void request( std::string file, std::string source = "", int width = 0, int height = 0 );
+    static void prefetch( std::string file, std::string source = "", int width = 0, int height = 0 );
+    static bool poll( std::string file, SDL_Surface *&surface );
+    static void release( std::string file );
+
+private:
+    struct Entry
+    {
+        SDL_Surface *surface;
+        int          refCount;
+        bool         decoded;
+        std::string  source;
+        int          width;
+        int          height;
+    };
+
+    static int worker( void *data );
+
+    static const unsigned int MAX_PREFETCHED = 32;
+
+    static std::vector<SDL_Thread *>    threads_;
+    static SDL_mutex                   *mutex_;
+    static SDL_cond                    *cond_;
+    static std::map<std::string, Entry> entries_;
+    static std::list<std::string>       queue_;
+    static std::list<std::string>       prefetched_;
+    static bool                         running_;
+};
@@ -331,7 +331,7 @@ void Page::start()
         for(std::vector<ScrollingList *>::iterator it2 = menus_[std::distance(menus_.begin(), it)].begin(); it2 != menus_[std::distance(menus_.begin(), it)].end(); it2++)
         {
             ScrollingList *menu = *it2;
-            menu->triggerEvent( "enter" );
+            menu->triggerEvent( EVENT_ENTER );
             menu->triggerEnterEvent();
         }
     }
@@ -343,7 +343,7 @@ void Page::start()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "enter" );
+        (*it)->triggerEvent( EVENT_ENTER );
     }
 }
 
@@ -355,7 +355,7 @@ void Page::stop()
         for(std::vector<ScrollingList *>::iterator it2 = menus_[std::distance(menus_.begin(), it)].begin(); it2 != menus_[std::distance(menus_.begin(), it)].end(); it2++)
         {
             ScrollingList *menu = *it2;
-            menu->triggerEvent( "exit" );
+            menu->triggerEvent( EVENT_EXIT );
             menu->triggerExitEvent();
         }
     }
@@ -367,7 +367,7 @@ void Page::stop()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "exit" );
+        (*it)->triggerEvent( EVENT_EXIT );
     }
 }
 
@@ -452,7 +452,7 @@ void Page::menuScroll()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "menuScroll", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_MENU_SCROLL, menuDepth_ - 1 );
     }
 }
 
@@ -470,12 +470,12 @@ void Page::highlightEnter()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "highlightEnter", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_HIGHLIGHT_ENTER, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerHighlightEnterEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "highlightEnter", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_HIGHLIGHT_ENTER, menuDepth_ - 1 );
                 menu->triggerHighlightEnterEvent( menuDepth_ - 1 );
             }
         }
@@ -483,7 +483,7 @@ void Page::highlightEnter()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "highlightEnter", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_HIGHLIGHT_ENTER, menuDepth_ - 1 );
     }
 }
 
@@ -501,12 +501,12 @@ void Page::highlightExit()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "highlightExit", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_HIGHLIGHT_EXIT, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerHighlightExitEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "highlightExit", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_HIGHLIGHT_EXIT, menuDepth_ - 1 );
                 menu->triggerHighlightExitEvent( menuDepth_ - 1 );
             }
         }
@@ -514,7 +514,7 @@ void Page::highlightExit()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "highlightExit", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_HIGHLIGHT_EXIT, menuDepth_ - 1 );
     }
 }
 
@@ -532,12 +532,12 @@ void Page::playlistEnter()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "playlistEnter", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_PLAYLIST_ENTER, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerPlaylistEnterEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "playlistEnter", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_PLAYLIST_ENTER, menuDepth_ - 1 );
                 menu->triggerPlaylistEnterEvent( menuDepth_ - 1 );
             }
         }
@@ -545,7 +545,7 @@ void Page::playlistEnter()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "playlistEnter", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_PLAYLIST_ENTER, menuDepth_ - 1 );
     }
 }
 
@@ -563,12 +563,12 @@ void Page::playlistExit()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "playlistExit", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_PLAYLIST_EXIT, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerPlaylistExitEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "playlistExit", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_PLAYLIST_EXIT, menuDepth_ - 1 );
                 menu->triggerPlaylistExitEvent( menuDepth_ - 1 );
             }
         }
@@ -576,7 +576,7 @@ void Page::playlistExit()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "playlistExit", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_PLAYLIST_EXIT, menuDepth_ - 1 );
     }
 }
 
@@ -594,12 +594,12 @@ void Page::menuJumpEnter()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "menuJumpEnter", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_JUMP_ENTER, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerMenuJumpEnterEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "menuJumpEnter", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_JUMP_ENTER, menuDepth_ - 1 );
                 menu->triggerMenuJumpEnterEvent( menuDepth_ - 1 );
             }
         }
@@ -607,7 +607,7 @@ void Page::menuJumpEnter()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "menuJumpEnter", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_MENU_JUMP_ENTER, menuDepth_ - 1 );
     }
 }
 
@@ -625,12 +625,12 @@ void Page::menuJumpExit()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "menuJumpExit", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_JUMP_EXIT, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerMenuJumpExitEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "menuJumpExit", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_JUMP_EXIT, menuDepth_ - 1 );
                 menu->triggerMenuJumpExitEvent( menuDepth_ - 1 );
             }
         }
@@ -638,7 +638,7 @@ void Page::menuJumpExit()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "menuJumpExit", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_MENU_JUMP_EXIT, menuDepth_ - 1 );
     }
 }
 
@@ -656,12 +656,12 @@ void Page::attractEnter()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "attractEnter", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_ATTRACT_ENTER, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerAttractEnterEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "attractEnter", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_ATTRACT_ENTER, menuDepth_ - 1 );
                 menu->triggerAttractEnterEvent( menuDepth_ - 1 );
             }
         }
@@ -669,7 +669,7 @@ void Page::attractEnter()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "attractEnter", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_ATTRACT_ENTER, menuDepth_ - 1 );
     }
 }
 
@@ -687,12 +687,12 @@ void Page::attract()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "attract", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_ATTRACT, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerAttractEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "attract", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_ATTRACT, menuDepth_ - 1 );
                 menu->triggerAttractEvent( menuDepth_ - 1 );
             }
         }
@@ -700,7 +700,7 @@ void Page::attract()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "attract", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_ATTRACT, menuDepth_ - 1 );
     }
 }
 
@@ -718,12 +718,12 @@ void Page::attractExit()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "attractExit", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_ATTRACT_EXIT, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerAttractExitEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "attractExit", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_ATTRACT_EXIT, menuDepth_ - 1 );
                 menu->triggerAttractExitEvent( menuDepth_ - 1 );
             }
         }
@@ -731,7 +731,7 @@ void Page::attractExit()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "attractExit", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_ATTRACT_EXIT, menuDepth_ - 1 );
     }
 }
 
@@ -749,12 +749,12 @@ void Page::jukeboxJump()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "jukeboxJump", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_JUKEBOX_JUMP, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerJukeboxJumpEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "jukeboxJump", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_JUKEBOX_JUMP, menuDepth_ - 1 );
                 menu->triggerJukeboxJumpEvent( menuDepth_ - 1 );
             }
         }
@@ -762,16 +762,17 @@ void Page::jukeboxJump()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "jukeboxJump", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_JUKEBOX_JUMP, menuDepth_ - 1 );
     }
 }
 
 
 void Page::triggerEvent( std::string action )
 {
+    int event = AnimationEvents::getEventId( action );
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( action );
+        (*it)->triggerEvent( event );
     }
 }
 
@@ -1019,12 +1020,12 @@ void Page::enterMenu()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "menuEnter", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_ENTER, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerMenuEnterEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "menuEnter", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_ENTER, menuDepth_ - 1 );
                 menu->triggerMenuEnterEvent( menuDepth_ - 1 );
             }
         }
@@ -1032,7 +1033,7 @@ void Page::enterMenu()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "menuEnter", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_MENU_ENTER, menuDepth_ - 1 );
     }
 
     return;
@@ -1050,12 +1051,12 @@ void Page::exitMenu()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "menuExit", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_EXIT, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerMenuExitEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "menuExit", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_MENU_EXIT, menuDepth_ - 1 );
                 menu->triggerMenuExitEvent( menuDepth_ - 1 );
             }
         }
@@ -1063,7 +1064,7 @@ void Page::exitMenu()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "menuExit", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_MENU_EXIT, menuDepth_ - 1 );
     }
 
     return;
@@ -1081,12 +1082,12 @@ void Page::enterGame()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "gameEnter", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_GAME_ENTER, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerGameEnterEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "gameEnter", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_GAME_ENTER, menuDepth_ - 1 );
                 menu->triggerGameEnterEvent( menuDepth_ - 1 );
             }
         }
@@ -1094,7 +1095,7 @@ void Page::enterGame()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "gameEnter", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_GAME_ENTER, menuDepth_ - 1 );
     }
 
     return;
@@ -1112,12 +1113,12 @@ void Page::exitGame()
             if(menuDepth_-1 == static_cast<unsigned int>(distance(menus_.begin(), it)))
             {
                 // Also trigger animations for index i for active menu
-                menu->triggerEvent( "gameExit", MENU_INDEX_HIGH + menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_GAME_EXIT, MENU_INDEX_HIGH + menuDepth_ - 1 );
                 menu->triggerGameExitEvent( MENU_INDEX_HIGH + menuDepth_ - 1 );
             }
             else
             {
-                menu->triggerEvent( "gameExit", menuDepth_ - 1 );
+                menu->triggerEvent( EVENT_GAME_EXIT, menuDepth_ - 1 );
                 menu->triggerGameExitEvent( menuDepth_ - 1 );
             }
         }
@@ -1125,7 +1126,7 @@ void Page::exitGame()
 
     for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
     {
-        (*it)->triggerEvent( "gameExit", menuDepth_ - 1 );
+        (*it)->triggerEvent( EVENT_GAME_EXIT, menuDepth_ - 1 );
     }
 
     return;
@@ -1367,12 +1368,18 @@ void Page::cleanup()
 
 void Page::draw()
 {
-    for(unsigned int i = 0; i < NUM_LAYERS; ++i)
+    layers_.update(LayerComponents);
+    for(MenuVector_T::iterator it = menus_.begin(); it != menus_.end(); it++)
     {
-        for(std::vector<Component *>::iterator it = LayerComponents.begin(); it != LayerComponents.end(); ++it)
+        for(std::vector<ScrollingList *>::iterator it2 = it->begin(); it2 != it->end(); it2++)
         {
-            if(*it && (*it)->baseViewInfo.Layer == i) (*it)->draw();
+            (*it2)->updateLayers();
         }
+    }
+
+    for(unsigned int i = 0; i < NUM_LAYERS; ++i)
+    {
+        layers_.draw(i);
 
         for(MenuVector_T::iterator it = menus_.begin(); it != menus_.end(); it++)
         {
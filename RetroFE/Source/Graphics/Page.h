@@ -16,6 +16,7 @@
 #pragma once
 
 #include "../Collection/CollectionInfo.h"
+#include "Component/ComponentLayers.h"
 
 #include <map>
 #include <string>
@@ -163,8 +164,9 @@ private:
     CollectionVector_T collections_;
     CollectionVector_T deleteCollections_;
 
-    static const unsigned int NUM_LAYERS = 20;
+    static const unsigned int NUM_LAYERS = ComponentLayers::NUM_LAYERS;
     std::vector<Component *> LayerComponents;
+    ComponentLayers layers_;
     std::list<ScrollingList *> deleteMenuList_;
     std::list<CollectionInfo *> deleteCollectionList_;
 
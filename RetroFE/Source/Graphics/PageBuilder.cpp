@@ -855,7 +855,7 @@ Font *PageBuilder::addFont(xml_node<> *component, xml_node<> *defaults)
     int monitor = monitorXml ? Utils::convertInt(monitorXml->value()) : monitor_;
     fontCache_->loadFont(fontName, fontSize, fontColor, monitor);
 
-    return fontCache_->getFont(fontName, fontSize, fontColor);
+    return fontCache_->getFont(fontName, fontSize, fontColor, monitor);
 }
 
 void PageBuilder::loadTweens(Component *c, xml_node<> *componentXml)
@@ -869,35 +869,35 @@ AnimationEvents *PageBuilder::createTweenInstance(xml_node<> *componentXml)
 {
     AnimationEvents *tweens = new AnimationEvents();
 
-    buildTweenSet(tweens, componentXml, "onEnter",          "enter");
-    buildTweenSet(tweens, componentXml, "onExit",           "exit");
-    buildTweenSet(tweens, componentXml, "onIdle",           "idle");
-    buildTweenSet(tweens, componentXml, "onMenuIdle",       "menuIdle");
-    buildTweenSet(tweens, componentXml, "onMenuScroll",     "menuScroll");
-    buildTweenSet(tweens, componentXml, "onHighlightEnter", "highlightEnter");
-    buildTweenSet(tweens, componentXml, "onHighlightExit",  "highlightExit");
-    buildTweenSet(tweens, componentXml, "onMenuEnter",      "menuEnter");
-    buildTweenSet(tweens, componentXml, "onMenuExit",       "menuExit");
-    buildTweenSet(tweens, componentXml, "onGameEnter",      "gameEnter");
-    buildTweenSet(tweens, componentXml, "onGameExit",       "gameExit");
-    buildTweenSet(tweens, componentXml, "onPlaylistEnter",  "playlistEnter");
-    buildTweenSet(tweens, componentXml, "onPlaylistExit",   "playlistExit");
-    buildTweenSet(tweens, componentXml, "onMenuJumpEnter",  "menuJumpEnter");
-    buildTweenSet(tweens, componentXml, "onMenuJumpExit",   "menuJumpExit");
-    buildTweenSet(tweens, componentXml, "onAttractEnter",   "attractEnter");
-    buildTweenSet(tweens, componentXml, "onAttract",        "attract");
-    buildTweenSet(tweens, componentXml, "onAttractExit",    "attractExit");
-    buildTweenSet(tweens, componentXml, "onJukeboxJump",    "jukeboxJump");
-
-    buildTweenSet(tweens, componentXml, "onMenuActionInputEnter",  "menuActionInputEnter");
-    buildTweenSet(tweens, componentXml, "onMenuActionInputExit",   "menuActionInputExit");
-    buildTweenSet(tweens, componentXml, "onMenuActionSelectEnter", "menuActionSelectEnter");
-    buildTweenSet(tweens, componentXml, "onMenuActionSelectExit",  "menuActionSelectExit");
+    buildTweenSet(tweens, componentXml, "onEnter",          EVENT_ENTER);
+    buildTweenSet(tweens, componentXml, "onExit",           EVENT_EXIT);
+    buildTweenSet(tweens, componentXml, "onIdle",           EVENT_IDLE);
+    buildTweenSet(tweens, componentXml, "onMenuIdle",       EVENT_MENU_IDLE);
+    buildTweenSet(tweens, componentXml, "onMenuScroll",     EVENT_MENU_SCROLL);
+    buildTweenSet(tweens, componentXml, "onHighlightEnter", EVENT_HIGHLIGHT_ENTER);
+    buildTweenSet(tweens, componentXml, "onHighlightExit",  EVENT_HIGHLIGHT_EXIT);
+    buildTweenSet(tweens, componentXml, "onMenuEnter",      EVENT_MENU_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuExit",       EVENT_MENU_EXIT);
+    buildTweenSet(tweens, componentXml, "onGameEnter",      EVENT_GAME_ENTER);
+    buildTweenSet(tweens, componentXml, "onGameExit",       EVENT_GAME_EXIT);
+    buildTweenSet(tweens, componentXml, "onPlaylistEnter",  EVENT_PLAYLIST_ENTER);
+    buildTweenSet(tweens, componentXml, "onPlaylistExit",   EVENT_PLAYLIST_EXIT);
+    buildTweenSet(tweens, componentXml, "onMenuJumpEnter",  EVENT_MENU_JUMP_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuJumpExit",   EVENT_MENU_JUMP_EXIT);
+    buildTweenSet(tweens, componentXml, "onAttractEnter",   EVENT_ATTRACT_ENTER);
+    buildTweenSet(tweens, componentXml, "onAttract",        EVENT_ATTRACT);
+    buildTweenSet(tweens, componentXml, "onAttractExit",    EVENT_ATTRACT_EXIT);
+    buildTweenSet(tweens, componentXml, "onJukeboxJump",    EVENT_JUKEBOX_JUMP);
+
+    buildTweenSet(tweens, componentXml, "onMenuActionInputEnter",  EVENT_MENU_ACTION_INPUT_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuActionInputExit",   EVENT_MENU_ACTION_INPUT_EXIT);
+    buildTweenSet(tweens, componentXml, "onMenuActionSelectEnter", EVENT_MENU_ACTION_SELECT_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuActionSelectExit",  EVENT_MENU_ACTION_SELECT_EXIT);
 
     return tweens;
 }
 
-void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXml, std::string tagName, std::string tweenName)
+void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXml, std::string tagName, int event)
 {
     for(componentXml = componentXml->first_node(tagName.c_str()); componentXml; componentXml = componentXml->next_sibling(tagName.c_str()))
     {
@@ -916,7 +916,7 @@ void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXm
                     {
                         Animation *animation = new Animation();
                         getTweenSet(componentXml, animation);
-                        tweens->setAnimation(tweenName, i, animation);
+                        tweens->setAnimation(event, i, animation);
                     }
                 }
             }
@@ -930,7 +930,7 @@ void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXm
                     {
                         Animation *animation = new Animation();
                         getTweenSet(componentXml, animation);
-                        tweens->setAnimation(tweenName, i, animation);
+                        tweens->setAnimation(event, i, animation);
                     }
                 }
             }
@@ -944,7 +944,7 @@ void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXm
                     {
                         Animation *animation = new Animation();
                         getTweenSet(componentXml, animation);
-                        tweens->setAnimation(tweenName, i, animation);
+                        tweens->setAnimation(event, i, animation);
                     }
                 }
             }
@@ -952,21 +952,21 @@ void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXm
             {
                 Animation *animation = new Animation();
                 getTweenSet(componentXml, animation);
-                tweens->setAnimation(tweenName, MENU_INDEX_HIGH, animation);
+                tweens->setAnimation(event, MENU_INDEX_HIGH, animation);
             }
             else
             {
                 int index = Utils::convertInt(indexXml->value());
                 Animation *animation = new Animation();
                 getTweenSet(componentXml, animation);
-                tweens->setAnimation(tweenName, index, animation);
+                tweens->setAnimation(event, index, animation);
             }
         }
         else
         {
             Animation *animation = new Animation();
             getTweenSet(componentXml, animation);
-            tweens->setAnimation(tweenName, -1, animation);
+            tweens->setAnimation(event, -1, animation);
         }
     }
 }
@@ -0,0 +1,196 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TextureCache.h"
+#include "../Database/Configuration.h"
+#include "../Utility/Log.h"
+#include "../SDL.h"
+
+std::map<TextureCache::Key, TextureCache::Entry> TextureCache::entries_;
+std::list<TextureCache::Key>                     TextureCache::unused_;
+size_t                                           TextureCache::bytes_  = 0;
+size_t                                           TextureCache::budget_ = 128 * 1024 * 1024;
+unsigned long                                    TextureCache::hits_   = 0;
+unsigned long                                    TextureCache::misses_ = 0;
+
+
+void TextureCache::initialize( Configuration &config )
+{
+    int size = 128;
+    config.getProperty( "textureCacheSize", size );
+    if ( size < 0 )
+    {
+        size = 0;
+    }
+    budget_ = static_cast<size_t>( size ) * 1024 * 1024;
+    hits_   = 0;
+    misses_ = 0;
+}
+
+
+void TextureCache::deInitialize( )
+{
+    logStats( );
+
+    SDL_LockMutex( SDL::getMutex( ) );
+    for ( std::map<Key, Entry>::iterator it = entries_.begin( ); it != entries_.end( ); ++it )
+    {
+        SDL_DestroyTexture( it->second.texture );
+    }
+    entries_.clear( );
+    unused_.clear( );
+    bytes_ = 0;
+    SDL_UnlockMutex( SDL::getMutex( ) );
+}
+
+
+// Returns a new reference to a cached texture, or NULL if the file has not
+// been loaded for this monitor
+SDL_Texture *TextureCache::acquire( std::string file, int monitor )
+{
+    SDL_Texture *texture = NULL;
+
+    SDL_LockMutex( SDL::getMutex( ) );
+    std::map<Key, Entry>::iterator it = entries_.find( Key( file, monitor ) );
+    if ( it != entries_.end( ) )
+    {
+        if ( it->second.refCount++ == 0 )
+        {
+            unused_.erase( it->second.lru );
+        }
+        texture = it->second.texture;
+        hits_++;
+    }
+    else
+    {
+        misses_++;
+    }
+    SDL_UnlockMutex( SDL::getMutex( ) );
+
+    return texture;
+}
+
+
+// Hands a freshly loaded texture to the cache and returns the texture the
+// caller now holds a reference to. If another component loaded the same
+// file meanwhile, the new texture is destroyed in favour of the cached one.
+SDL_Texture *TextureCache::insert( std::string file, int monitor, SDL_Texture *texture )
+{
+    Uint32 format;
+    int    width;
+    int    height;
+
+    SDL_LockMutex( SDL::getMutex( ) );
+    Key key( file, monitor );
+    std::map<Key, Entry>::iterator it = entries_.find( key );
+    if ( it != entries_.end( ) )
+    {
+        SDL_DestroyTexture( texture );
+        if ( it->second.refCount++ == 0 )
+        {
+            unused_.erase( it->second.lru );
+        }
+        texture = it->second.texture;
+    }
+    else
+    {
+        SDL_QueryTexture( texture, &format, NULL, &width, &height );
+        int bytesPerPixel = SDL_BYTESPERPIXEL( format );
+        if ( bytesPerPixel == 0 )
+        {
+            bytesPerPixel = 4;
+        }
+
+        Entry entry;
+        entry.texture  = texture;
+        entry.bytes    = static_cast<size_t>( width ) * height * bytesPerPixel;
+        entry.refCount = 1;
+        entries_[key]  = entry;
+        bytes_        += entry.bytes;
+
+        evict( );
+    }
+    SDL_UnlockMutex( SDL::getMutex( ) );
+
+    return texture;
+}
+
+
+void TextureCache::release( std::string file, int monitor )
+{
+    SDL_LockMutex( SDL::getMutex( ) );
+    std::map<Key, Entry>::iterator it = entries_.find( Key( file, monitor ) );
+    if ( it != entries_.end( ) && --it->second.refCount == 0 )
+    {
+        it->second.lru = unused_.insert( unused_.end( ), it->first );
+        evict( );
+    }
+    SDL_UnlockMutex( SDL::getMutex( ) );
+}
+
+
+bool TextureCache::contains( std::string file, int monitor )
+{
+    SDL_LockMutex( SDL::getMutex( ) );
+    bool found = entries_.find( Key( file, monitor ) ) != entries_.end( );
+    SDL_UnlockMutex( SDL::getMutex( ) );
+
+    return found;
+}
+
+
+// Destroy all textures that are not in use, e.g. before launching a game
+void TextureCache::flush( )
+{
+    logStats( );
+
+    SDL_LockMutex( SDL::getMutex( ) );
+    size_t budget = budget_;
+    budget_ = 0;
+    evict( );
+    budget_ = budget;
+    SDL_UnlockMutex( SDL::getMutex( ) );
+}
+
+
+// Drop the least recently used textures until the cache fits its budget.
+// Textures that are still referenced are never evicted.
+void TextureCache::evict( )
+{
+    while ( bytes_ > budget_ && !unused_.empty( ) )
+    {
+        std::map<Key, Entry>::iterator it = entries_.find( unused_.front( ) );
+        unused_.pop_front( );
+        if ( it != entries_.end( ) )
+        {
+            SDL_DestroyTexture( it->second.texture );
+            bytes_ -= it->second.bytes;
+            entries_.erase( it );
+        }
+    }
+}
+
+
+void TextureCache::logStats( )
+{
+    unsigned long lookups = hits_ + misses_;
+    if ( lookups == 0 ) return;
+
+    std::string ratio = std::to_string( static_cast<int>( 100.0 * hits_ / lookups ) );
+    Logger::write( Logger::ZONE_INFO, "TextureCache", std::to_string( hits_ ) + " hits, " + std::to_string( misses_ ) +
+                   " misses (" + ratio + "%), " + std::to_string( entries_.size( ) ) + " textures using " +
+                   std::to_string( bytes_ / 1024 ) + " KB" );
+}
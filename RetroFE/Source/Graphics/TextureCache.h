@@ -0,0 +1,61 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <list>
+#include <map>
+#include <utility>
+
+class Configuration;
+
+// Shares image textures between components and keeps recently released
+// ones around, so scrolling back over a list does not decode them again.
+// Unused textures are evicted least recently used first once the cache
+// grows beyond its byte budget.
+class TextureCache
+{
+public:
+    static void initialize( Configuration &config );
+    static void deInitialize( );
+    static SDL_Texture *acquire( std::string file, int monitor );
+    static SDL_Texture *insert( std::string file, int monitor, SDL_Texture *texture );
+    static void release( std::string file, int monitor );
+    static bool contains( std::string file, int monitor );
+    static void flush( );
+
+private:
+    typedef std::pair<std::string, int> Key;
+
+    struct Entry
+    {
+        SDL_Texture               *texture;
+        size_t                     bytes;
+        int                        refCount;
+        std::list<Key>::iterator   lru;
+    };
+
+    static void evict( );
+    static void logStats( );
+
+    static std::map<Key, Entry> entries_;
+    static std::list<Key>       unused_;
+    static size_t               bytes_;
+    static size_t               budget_;
+    static unsigned long        hits_;
+    static unsigned long        misses_;
+};
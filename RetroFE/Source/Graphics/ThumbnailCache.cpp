@@ -0,0 +1,360 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ThumbnailCache.h"
+#include "../Database/Configuration.h"
+#include "../Utility/Utils.h"
+#include "../Utility/Log.h"
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+
+#if defined(_WIN32) && !defined(__GNUC__)
+#include <windows.h>
+#endif
+
+bool                  ThumbnailCache::enabled_ = false;
+std::string           ThumbnailCache::path_;
+std::set<std::string> ThumbnailCache::fits_;
+SDL_mutex            *ThumbnailCache::mutex_   = NULL;
+
+
+void ThumbnailCache::initialize( Configuration &config )
+{
+    enabled_ = false;
+    config.getProperty( "thumbnailCache", enabled_ );
+    if ( !enabled_ ) return;
+
+    std::string cachePath = Utils::combinePath( Configuration::absolutePath, "cache" );
+    path_ = Utils::combinePath( cachePath, "thumbnails" );
+
+    std::string dirs[] = { cachePath, path_ };
+    for ( unsigned int i = 0; i < 2; ++i )
+    {
+#if defined(_WIN32) && !defined(__GNUC__)
+        CreateDirectory( dirs[i].c_str( ), NULL );
+#elif defined(__MINGW32__)
+        mkdir( dirs[i].c_str( ) );
+#else
+        mkdir( dirs[i].c_str( ), 0755 );
+#endif
+    }
+
+    struct stat sb;
+    if ( stat( path_.c_str( ), &sb ) != 0 )
+    {
+        Logger::write( Logger::ZONE_WARNING, "ThumbnailCache", "Could not create " + path_ + "; thumbnails disabled" );
+        enabled_ = false;
+        return;
+    }
+
+    if ( !mutex_ )
+    {
+        mutex_ = SDL_CreateMutex( );
+    }
+
+    int size = 256;
+    config.getProperty( "thumbnailCacheSize", size );
+    if ( size < 0 )
+    {
+        size = 0;
+    }
+    cleanup( static_cast<size_t>( size ) * 1024 * 1024 );
+}
+
+
+void ThumbnailCache::deInitialize( )
+{
+    fits_.clear( );
+    if ( mutex_ )
+    {
+        SDL_DestroyMutex( mutex_ );
+        mutex_ = NULL;
+    }
+}
+
+
+// Delete thumbnails of sources that have changed since, which are the ones
+// with an older source time than another thumbnail of the same file and
+// size, then the oldest thumbnails until the rest fits in the budget. A
+// budget of 0 leaves the size unbounded. Remembers the surviving markers.
+void ThumbnailCache::cleanup( size_t budget )
+{
+    DIR *dp = opendir( path_.c_str( ) );
+    if ( dp == NULL )
+    {
+        return;
+    }
+
+    std::vector<File>                files;
+    std::map<std::string, long long> newest;
+    struct dirent                   *dirp;
+    unsigned int                     removed = 0;
+
+    while ( (dirp = readdir( dp )) != NULL )
+    {
+        std::string name = dirp->d_name;
+        std::string path = Utils::combinePath( path_, name );
+        size_t      dot  = name.find_last_of( "." );
+        if ( name == "." || name == ".." || dot == std::string::npos )
+        {
+            continue;
+        }
+
+        std::string extension = name.substr( dot );
+        if ( extension == ".tmp" )
+        {
+            // left behind by a run that stopped while writing
+            std::remove( path.c_str( ) );
+            removed++;
+            continue;
+        }
+
+        // <hash>-<source time>-<width>x<height>.bmp or .full
+        size_t first = name.find( '-' );
+        size_t last  = name.find_last_of( '-' );
+        struct stat sb;
+        if ( (extension != ".bmp" && extension != ".full") || first == std::string::npos || last == first ||
+             stat( path.c_str( ), &sb ) != 0 )
+        {
+            continue;
+        }
+
+        File file;
+        file.name       = name;
+        file.group      = name.substr( 0, first ) + name.substr( last, dot - last );
+        file.sourceTime = std::atoll( name.substr( first + 1, last - first - 1 ).c_str( ) );
+        file.fileTime   = sb.st_mtime;
+        file.bytes      = static_cast<size_t>( sb.st_size );
+        files.push_back( file );
+
+        std::map<std::string, long long>::iterator it = newest.find( file.group );
+        if ( it == newest.end( ) || it->second < file.sourceTime )
+        {
+            newest[file.group] = file.sourceTime;
+        }
+    }
+    closedir( dp );
+
+    std::vector<File> current;
+    size_t            bytes = 0;
+    for ( std::vector<File>::iterator it = files.begin( ); it != files.end( ); ++it )
+    {
+        if ( it->sourceTime < newest[it->group] )
+        {
+            std::remove( Utils::combinePath( path_, it->name ).c_str( ) );
+            removed++;
+        }
+        else
+        {
+            current.push_back( *it );
+            bytes += it->bytes;
+        }
+    }
+
+    // oldest first
+    std::sort( current.begin( ), current.end( ), []( const File &a, const File &b ) { return a.fileTime < b.fileTime; } );
+
+    for ( std::vector<File>::iterator it = current.begin( ); it != current.end( ); ++it )
+    {
+        std::string path = Utils::combinePath( path_, it->name );
+        if ( budget > 0 && bytes > budget && it->bytes > 0 )
+        {
+            std::remove( path.c_str( ) );
+            bytes -= it->bytes;
+            removed++;
+        }
+        else if ( it->name.substr( it->name.find_last_of( "." ) ) == ".full" )
+        {
+            fits_.insert( path.substr( 0, path.find_last_of( "." ) ) + ".bmp" );
+        }
+    }
+
+    if ( removed > 0 )
+    {
+        std::stringstream ss;
+        ss << "Removed " << removed << " stale thumbnails, " << bytes / (1024 * 1024) << " MB left";
+        Logger::write( Logger::ZONE_INFO, "ThumbnailCache", ss.str( ) );
+    }
+}
+
+
+// Empty file recording that the source already fits the thumbnail size
+std::string ThumbnailCache::getMarker( std::string thumbnail )
+{
+    return thumbnail.substr( 0, thumbnail.find_last_of( "." ) ) + ".full";
+}
+
+
+bool ThumbnailCache::isEnabled( )
+{
+    return enabled_;
+}
+
+
+// Returns the thumbnail file for showing the image at up to width x height,
+// or an empty string if the image should be loaded as is. A size of 0 leaves
+// that side unconstrained. Sizes are rounded up so slots of about the same
+// size share their thumbnails.
+std::string ThumbnailCache::getPath( std::string file, int width, int height )
+{
+    struct stat sb;
+
+    if ( !enabled_ || (width <= 0 && height <= 0) || stat( file.c_str( ), &sb ) != 0 )
+    {
+        return "";
+    }
+
+    width  = ((width  + SIZE_STEP - 1) / SIZE_STEP) * SIZE_STEP;
+    height = ((height + SIZE_STEP - 1) / SIZE_STEP) * SIZE_STEP;
+
+    std::stringstream ss;
+    ss << std::hex << std::setw( 16 ) << std::setfill( '0' ) << static_cast<unsigned long long>( std::hash<std::string>( )( file ) )
+       << std::dec << "-" << static_cast<long long>( sb.st_mtime ) << "-" << width << "x" << height << ".bmp";
+
+    std::string thumbnail = Utils::combinePath( path_, ss.str( ) );
+
+    SDL_LockMutex( mutex_ );
+    bool fits = fits_.find( thumbnail ) != fits_.end( );
+    SDL_UnlockMutex( mutex_ );
+
+    return fits ? "" : thumbnail;
+}
+
+
+// Scale a decoded image to cover width x height and store it as the
+// thumbnail. Returns the scaled surface, or NULL if the source already fits;
+// that is remembered so getPath points straight at the source next time.
+SDL_Surface *ThumbnailCache::create( SDL_Surface *source, std::string thumbnail, int width, int height )
+{
+    width  = ((width  + SIZE_STEP - 1) / SIZE_STEP) * SIZE_STEP;
+    height = ((height + SIZE_STEP - 1) / SIZE_STEP) * SIZE_STEP;
+
+    double scaleW = static_cast<double>( width ) / source->w;
+    double scaleH = static_cast<double>( height ) / source->h;
+    double factor = (scaleW > scaleH) ? scaleW : scaleH;
+    if ( factor >= 1 )
+    {
+        FILE *marker = std::fopen( getMarker( thumbnail ).c_str( ), "wb" );
+        if ( marker )
+        {
+            std::fclose( marker );
+        }
+
+        SDL_LockMutex( mutex_ );
+        fits_.insert( thumbnail );
+        SDL_UnlockMutex( mutex_ );
+
+        return NULL;
+    }
+
+    int thumbWidth  = static_cast<int>( source->w * factor + 0.5 );
+    int thumbHeight = static_cast<int>( source->h * factor + 0.5 );
+    SDL_Surface *surface = scale( source, (thumbWidth > 0) ? thumbWidth : 1, (thumbHeight > 0) ? thumbHeight : 1 );
+    if ( !surface )
+    {
+        return NULL;
+    }
+
+    // Write to a temporary file first so a half written thumbnail is never loaded
+    std::string temp = thumbnail + ".tmp";
+    if ( SDL_SaveBMP( surface, temp.c_str( ) ) != 0 || std::rename( temp.c_str( ), thumbnail.c_str( ) ) != 0 )
+    {
+        std::string error = SDL_GetError( );
+        Logger::write( Logger::ZONE_WARNING, "ThumbnailCache", "Could not write " + thumbnail + ": " + error );
+        std::remove( temp.c_str( ) );
+    }
+
+    return surface;
+}
+
+
+// Box filter downscale; every destination pixel averages the source pixels
+// it covers. Colours are weighted by alpha so transparent pixels, which are
+// usually black, do not darken the edges of the artwork.
+SDL_Surface *ThumbnailCache::scale( SDL_Surface *source, int width, int height )
+{
+    SDL_Surface *src = SDL_ConvertSurfaceFormat( source, SDL_PIXELFORMAT_ARGB8888, 0 );
+    if ( !src )
+    {
+        return NULL;
+    }
+
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat( 0, width, height, 32, SDL_PIXELFORMAT_ARGB8888 );
+    if ( !dst )
+    {
+        SDL_FreeSurface( src );
+        return NULL;
+    }
+
+    SDL_LockSurface( src );
+    SDL_LockSurface( dst );
+
+    for ( int y = 0; y < height; ++y )
+    {
+        int y0 = y * src->h / height;
+        int y1 = (y + 1) * src->h / height;
+        if ( y1 <= y0 ) y1 = y0 + 1;
+
+        Uint32 *out = reinterpret_cast<Uint32 *>( static_cast<Uint8 *>( dst->pixels ) + y * dst->pitch );
+
+        for ( int x = 0; x < width; ++x )
+        {
+            int x0 = x * src->w / width;
+            int x1 = (x + 1) * src->w / width;
+            if ( x1 <= x0 ) x1 = x0 + 1;
+
+            Uint64 sum[4] = { 0, 0, 0, 0 };
+            for ( int sy = y0; sy < y1; ++sy )
+            {
+                const Uint32 *in = reinterpret_cast<const Uint32 *>( static_cast<Uint8 *>( src->pixels ) + sy * src->pitch );
+                for ( int sx = x0; sx < x1; ++sx )
+                {
+                    Uint32 p = in[sx];
+                    Uint64 a = (p >> 24) & 0xff;
+                    sum[0] += a;
+                    sum[1] += ((p >> 16) & 0xff) * a;
+                    sum[2] += ((p >> 8) & 0xff) * a;
+                    sum[3] += (p & 0xff) * a;
+                }
+            }
+
+            Uint64 count = static_cast<Uint64>( y1 - y0 ) * (x1 - x0);
+            if ( sum[0] == 0 )
+            {
+                out[x] = 0;
+            }
+            else
+            {
+                out[x] = static_cast<Uint32>( ((sum[0] / count) << 24) | ((sum[1] / sum[0]) << 16) | ((sum[2] / sum[0]) << 8) | (sum[3] / sum[0]) );
+            }
+        }
+    }
+
+    SDL_UnlockSurface( dst );
+    SDL_UnlockSurface( src );
+    SDL_FreeSurface( src );
+
+    return dst;
+}
@@ -0,0 +1,59 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <set>
+#include <ctime>
+
+class Configuration;
+
+// Keeps downscaled copies of large artwork on disk, so list items that are
+// shown much smaller than their source image upload a small texture. A
+// thumbnail is named after its source path, modification time and size.
+// Sources that already fit get an empty marker file instead, so they are
+// loaded directly from then on.
+class ThumbnailCache
+{
+public:
+    static void initialize( Configuration &config );
+    static void deInitialize( );
+    static bool isEnabled( );
+    static std::string getPath( std::string file, int width, int height );
+    static SDL_Surface *create( SDL_Surface *source, std::string thumbnail, int width, int height );
+
+private:
+    struct File
+    {
+        std::string name;
+        std::string group;
+        long long   sourceTime;
+        time_t      fileTime;
+        size_t      bytes;
+    };
+
+    static void cleanup( size_t budget );
+    static std::string getMarker( std::string thumbnail );
+    static SDL_Surface *scale( SDL_Surface *source, int width, int height );
+
+    static const int SIZE_STEP = 32;
+
+    static bool                  enabled_;
+    static std::string           path_;
+    static std::set<std::string> fits_;
+    static SDL_mutex            *mutex_;
+};
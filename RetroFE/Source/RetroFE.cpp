@@ -29,6 +29,10 @@
 #include "Control/UserInput.h"
 #include "Graphics/PageBuilder.h"
 #include "Graphics/Page.h"
+#include "Graphics/ImageLoader.h"
+#include "Graphics/TextureCache.h"
+#include "Graphics/ThumbnailCache.h"
+#include "Utility/MediaIndex.h"
 #include "Graphics/Component/ScrollingList.h"
 #include "Graphics/Component/Video.h"
 #include <gst/gst.h>
@@ -71,6 +75,9 @@ RetroFE::RetroFE( Configuration &c )
     , keyLastTime_(0)
     , keyDelayTime_(.3f)
     , reboot_(false)
+    , drawStats_(false)
+    , statsFrames_(0)
+    , statsTime_(0)
 {
     menuMode_                            = false;
     attractMode_                         = false;
@@ -85,6 +92,25 @@ RetroFE::~RetroFE( )
 }
 
 
+// Show the average number of draw calls and quads per frame, once a second,
+// in the window title and the log
+void RetroFE::updateDrawStats( )
+{
+    statsFrames_++;
+    if ( currentTime_ - statsTime_ < 1 )
+        return;
+
+    std::string stats = std::to_string( SDL::getDrawCalls( ) / statsFrames_ ) + " draw calls, " +
+                        std::to_string( SDL::getQuads( ) / statsFrames_ ) + " quads per frame";
+    SDL_SetWindowTitle( SDL::getWindow( 0 ), ("RetroFE - " + stats).c_str( ) );
+    Logger::write( Logger::ZONE_INFO, "RetroFE", "Render stats: " + stats );
+
+    SDL::resetStats( );
+    statsFrames_ = 0;
+    statsTime_   = currentTime_;
+}
+
+
 // Render the current page to the screen
 void RetroFE::render( )
 {
@@ -100,6 +126,7 @@ void RetroFE::render( )
     {
         currentPage_->draw( );
     }
+    SDL::flush( );
 
     for ( int i = 0; i < SDL::getNumDisplays( ); ++i )
     {
@@ -107,6 +134,15 @@ void RetroFE::render( )
     }
     SDL_UnlockMutex( SDL::getMutex( ) );
 
+    if ( drawStats_ )
+    {
+        updateDrawStats( );
+    }
+    else
+    {
+        SDL::resetStats( );
+    }
+
 }
 
 
@@ -143,6 +179,8 @@ int RetroFE::initialize( void *context )
         return -1;
     }
 
+    MediaIndex::load( *(instance->db_) );
+
     instance->initialized = true;
     return 0;
 
@@ -174,6 +212,10 @@ void RetroFE::launchEnter( )
 void RetroFE::launchExit( )
 {
 
+    // Media may have been added while the game ran, and not every file
+    // system updates directory modification times
+    MediaIndex::refresh( );
+
     // Optionally set up SDL, and load the textures
     allocateGraphicsMemory( );
 
@@ -220,6 +262,8 @@ void RetroFE::freeGraphicsMemory( )
     {
         currentPage_->freeGraphicsMemory( );
     }
+    TextureCache::flush( );
+    VideoFactory::flush( );
 
     // Close down SDL
     bool unloadSDL = false;
@@ -272,6 +316,23 @@ bool RetroFE::deInitialize( )
         delete currentPage_;
         currentPage_ = NULL;
     }
+    VideoFactory::flush( );
+
+    std::stringstream ss;
+    ss << "Reloaded media " << Component::getReloadCount( ) << " times, skipped " << Component::getReloadsAvoided( ) << " reloads while scrolling";
+    Logger::write( Logger::ZONE_INFO, "RetroFE", ss.str( ) );
+
+    // Stop the background image decoders
+    ImageLoader::deInitialize( );
+    TextureCache::deInitialize( );
+    ThumbnailCache::deInitialize( );
+
+    // Remember the media directory listings for the next start
+    if ( db_ )
+    {
+        MediaIndex::save( *db_ );
+    }
+    MediaIndex::deInitialize( );
 
     // Delete databases
     if ( metadb_ )
@@ -309,7 +370,15 @@ bool RetroFE::run( )
 
     // Initialize SDL
     if(! SDL::initialize( config_ ) ) return false;
-    fontcache_.initialize( );
+    fontcache_.initialize( config_ );
+
+    // Index the media directories on first use
+    MediaIndex::initialize( );
+
+    // Start the background image decoders
+    ImageLoader::initialize( config_ );
+    TextureCache::initialize( config_ );
+    ThumbnailCache::initialize( config_ );
 
     // Define control configuration
     std::string controlsConfPath = Utils::combinePath( Configuration::absolutePath, "controls.conf" );
@@ -322,14 +391,25 @@ bool RetroFE::run( )
     float preloadTime = 0;
 
     // Initialize video
-    bool videoEnable = true;
-    int  videoLoop   = 0;
+    bool videoEnable   = true;
+    int  videoLoop     = 0;
+    int  videoPoolSize = 2;
+    int  videoPreroll  = 2;
     config_.getProperty( "videoEnable", videoEnable );
     config_.getProperty( "videoLoop", videoLoop );
+    config_.getProperty( "videoPoolSize", videoPoolSize );
+    config_.getProperty( "videoPreroll", videoPreroll );
     VideoFactory::setEnabled( videoEnable );
     VideoFactory::setNumLoops( videoLoop );
+    VideoFactory::setPoolSize( videoPoolSize );
+    VideoFactory::setPrerollSize( videoPreroll );
     Video::setEnabled( videoEnable );
 
+    // Media waits for the selection to settle before reloading while scrolling
+    int reloadSettleTime = 150;
+    config_.getProperty( "reloadSettleTime", reloadSettleTime );
+    Component::setReloadSettleTime( static_cast<float>( reloadSettleTime ) / 1000 );
+
     initializeThread = SDL_CreateThread( initialize, "RetroFEInit", (void *)this );
 
     if ( !initializeThread )
@@ -370,6 +450,8 @@ bool RetroFE::run( )
     double fpsTime     = 1000.0 / static_cast<double>(fps);
     double fpsIdleTime = 1000.0 / static_cast<double>(fpsIdle);
 
+    config_.getProperty( "drawStats", drawStats_ );
+
     int initializeStatus = 0;
     bool inputClear      = false;
 
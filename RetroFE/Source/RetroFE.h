@@ -109,6 +109,7 @@ private:
     };
 
     void            render( );
+    void            updateDrawStats( );
     bool            back( bool &exit );
     void            quit( );
     Page           *loadPage( );
@@ -138,6 +139,9 @@ private:
 	int                attractModePlaylistCollectionNumber_;
 	bool               reboot_;
 	std::string        firstPlaylist_;
+    bool               drawStats_;
+    unsigned int       statsFrames_;
+    float              statsTime_;
 
     std::map<std::string, unsigned int> lastMenuOffsets_;
     std::map<std::string, std::string>  lastMenuPlaylists_;
@@ -15,10 +15,13 @@
  */
 
 
+#define _USE_MATH_DEFINES
 #include "SDL.h"
 #include "Database/Configuration.h"
 #include "Utility/Log.h"
 #include <SDL2/SDL_mixer.h>
+#include <algorithm>
+#include <cmath>
 
 std::vector<SDL_Window *>   SDL::window_;
 std::vector<SDL_Renderer *> SDL::renderer_;
@@ -30,6 +33,14 @@ std::vector<int>            SDL::windowHeight_;
 std::vector<bool>           SDL::fullscreen_;
 std::vector<int>            SDL::rotation_;
 std::vector<bool>           SDL::mirror_;
+std::vector<SDL::RenderContext> SDL::renderContext_;
+bool                        SDL::batching_ = false;
+unsigned int                SDL::drawCalls_ = 0;
+unsigned int                SDL::quads_ = 0;
+std::atomic<unsigned int>   SDL::targetResets_( 0 );
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+std::vector<SDL::RenderBatch> SDL::batch_;
+#endif
 int                         SDL::numScreens_ = 1;
 int                         SDL::numDisplays_ = 1;
 
@@ -218,6 +229,20 @@ bool SDL::initialize( Configuration &config )
         }
     }
 
+    std::vector<RenderContext>( numScreens_ ).swap( renderContext_ );
+    SDL_AddEventWatch( eventWatch, NULL );
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    batching_ = true;
+    config.getProperty( "renderBatching", batching_ );
+    RenderBatch batch;
+    batch.texture   = NULL;
+    batch.blendMode = SDL_BLENDMODE_NONE;
+    batch_.assign( numScreens_, batch );
+#else
+    Logger::write( Logger::ZONE_INFO, "SDL", "Render batching needs SDL 2.0.18 or later; drawing every quad separately" );
+#endif
+
     if ( SDL_SetHint( SDL_HINT_RENDER_SCALE_QUALITY, "1") != SDL_TRUE )
     {
         Logger::write( Logger::ZONE_ERROR, "SDL", "Improve scale quality. Continuing with low-quality settings." );
@@ -265,6 +290,12 @@ bool SDL::deInitialize( )
     Mix_CloseAudio( );
     Mix_Quit( );
 
+    SDL_DelEventWatch( eventWatch, NULL );
+    renderContext_.clear( );
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    batch_.clear( );
+#endif
+
     if ( mutex_ )
     {
         SDL_DestroyMutex(mutex_);
@@ -326,6 +357,221 @@ SDL_Window* SDL::getWindow( int index )
 }
 
 
+// Mark the render context of a resized window for recomputation, and
+// count resets of the renderers, which lose the contents of target textures
+int SDL::eventWatch( void *, SDL_Event *event )
+{
+    if ( event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET )
+    {
+        targetResets_++;
+    }
+
+    if ( event->type == SDL_WINDOWEVENT && event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED )
+    {
+        for ( unsigned int i = 0; i < window_.size( ) && i < renderContext_.size( ); ++i )
+        {
+            if ( window_[i] && SDL_GetWindowID( window_[i] ) == event->window.windowID )
+            {
+                renderContext_[i].dirty = true;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+// Get the scale factors, offsets and rotation for drawing a layout on a monitor
+SDL::RenderContext &SDL::getRenderContext( int monitor, int layoutWidth, int layoutHeight )
+{
+    RenderContext &context = renderContext_[monitor];
+
+    // Clear the flag before reading the size, so a resize that arrives in
+    // between is seen on the next frame
+    bool resized = context.dirty.exchange( false );
+    if ( resized || context.layoutWidth != layoutWidth || context.layoutHeight != layoutHeight )
+    {
+        if ( resized )
+        {
+            SDL_GetWindowSize( getWindow( monitor ), &windowWidth_[monitor], &windowHeight_[monitor] );
+        }
+        context.layoutWidth  = layoutWidth;
+        context.layoutHeight = layoutHeight;
+
+        context.scaleX = (float)windowWidth_[monitor]  / (float)layoutWidth;
+        context.scaleY = (float)windowHeight_[monitor] / (float)layoutHeight;
+
+        if ( rotation_[monitor] % 2 == 1 ) // 90 or 270 degree rotation; change scale factors
+        {
+            context.scaleX = (float)windowHeight_[monitor] / (float)layoutWidth;
+            context.scaleY = (float)windowWidth_[monitor]  / (float)layoutHeight;
+        }
+
+        if ( mirror_[monitor] )
+            context.scaleY /= 2;
+
+        context.offsetX = 0;
+        context.offsetY = 0;
+        if ( fullscreen_[monitor] )
+        {
+            context.offsetX = (displayWidth_[monitor] - windowWidth_[monitor])/2;
+            context.offsetY = (displayHeight_[monitor] - windowHeight_[monitor])/2;
+        }
+
+        context.angle = 0;
+        if ( !mirror_[monitor] )
+            context.angle = rotation_[monitor] * 90;
+    }
+
+    return context;
+}
+
+
+// Draw one textured quad, rotated around its center. With batching enabled
+// the quad is added to the monitor's batch, which is submitted when a quad
+// with another texture or blend mode arrives or when the frame is flushed.
+void SDL::renderQuad( int monitor, SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect *dest, double angle, SDL_RendererFlip flip )
+{
+    quads_++;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if ( batching_ )
+    {
+        RenderBatch &batch = batch_[monitor];
+        SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+        SDL_GetTextureBlendMode( texture, &blendMode );
+        if ( batch.texture != texture || batch.blendMode != blendMode )
+        {
+            flush( monitor );
+            int w = 0;
+            int h = 0;
+            SDL_QueryTexture( texture, NULL, NULL, &w, &h );
+            batch.texture       = texture;
+            batch.blendMode     = blendMode;
+            batch.textureWidth  = static_cast<float>( w );
+            batch.textureHeight = static_cast<float>( h );
+        }
+
+        // Geometry ignores the texture modulation, so pass it per vertex
+        SDL_Color color;
+        SDL_GetTextureColorMod( texture, &color.r, &color.g, &color.b );
+        color.a = static_cast<Uint8>( alpha * 255 );
+
+        float u0 = src->x / batch.textureWidth;
+        float v0 = src->y / batch.textureHeight;
+        float u1 = (src->x + src->w) / batch.textureWidth;
+        float v1 = (src->y + src->h) / batch.textureHeight;
+        if ( flip & SDL_FLIP_HORIZONTAL )
+            std::swap( u0, u1 );
+        if ( flip & SDL_FLIP_VERTICAL )
+            std::swap( v0, v1 );
+
+        float  halfW   = dest->w / 2.0f;
+        float  halfH   = dest->h / 2.0f;
+        float  centerX = dest->x + halfW;
+        float  centerY = dest->y + halfH;
+        double radians = angle * M_PI / 180.0;
+        float  cosA    = static_cast<float>( cos( radians ) );
+        float  sinA    = static_cast<float>( sin( radians ) );
+
+        static const float cornerX[4] = { -1,  1, 1, -1 };
+        static const float cornerY[4] = { -1, -1, 1,  1 };
+        int first = static_cast<int>( batch.vertices.size( ) );
+        for ( int i = 0; i < 4; ++i )
+        {
+            float x = cornerX[i] * halfW;
+            float y = cornerY[i] * halfH;
+
+            SDL_Vertex vertex;
+            vertex.position.x  = centerX + x * cosA - y * sinA;
+            vertex.position.y  = centerY + x * sinA + y * cosA;
+            vertex.color       = color;
+            vertex.tex_coord.x = (cornerX[i] < 0) ? u0 : u1;
+            vertex.tex_coord.y = (cornerY[i] < 0) ? v0 : v1;
+            batch.vertices.push_back( vertex );
+        }
+        batch.indices.push_back( first );
+        batch.indices.push_back( first + 1 );
+        batch.indices.push_back( first + 2 );
+        batch.indices.push_back( first );
+        batch.indices.push_back( first + 2 );
+        batch.indices.push_back( first + 3 );
+        return;
+    }
+#endif
+
+    SDL_SetTextureAlphaMod( texture, static_cast<char>( alpha * 255 ) );
+    SDL_RenderCopyEx( renderer_[monitor], texture, src, dest, angle, NULL, flip );
+    drawCalls_++;
+}
+
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+// Submit the quads batched for a monitor
+void SDL::flush( int monitor )
+{
+    RenderBatch &batch = batch_[monitor];
+    if ( batch.indices.size( ) > 0 )
+    {
+        // The texture is drawn with its blend mode at submit time, which may
+        // have been changed since the quads were added
+        SDL_BlendMode blendMode = batch.blendMode;
+        SDL_GetTextureBlendMode( batch.texture, &blendMode );
+        if ( blendMode != batch.blendMode )
+            SDL_SetTextureBlendMode( batch.texture, batch.blendMode );
+        SDL_RenderGeometry( renderer_[monitor], batch.texture, &batch.vertices[0], static_cast<int>( batch.vertices.size( ) ), &batch.indices[0], static_cast<int>( batch.indices.size( ) ) );
+        if ( blendMode != batch.blendMode )
+            SDL_SetTextureBlendMode( batch.texture, blendMode );
+        drawCalls_++;
+    }
+    batch.texture = NULL;
+    batch.vertices.clear( );
+    batch.indices.clear( );
+}
+#endif
+
+
+// Submit all batched quads; must be called before presenting a frame or
+// drawing to a renderer without going through renderCopy.
+void SDL::flush( )
+{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    for ( unsigned int i = 0; i < batch_.size( ); ++i )
+    {
+        flush( i );
+    }
+#endif
+}
+
+
+// Number of draw calls submitted since the last resetStats
+unsigned int SDL::getDrawCalls( )
+{
+    return drawCalls_;
+}
+
+
+// Number of quads drawn since the last resetStats
+unsigned int SDL::getQuads( )
+{
+    return quads_;
+}
+
+
+void SDL::resetStats( )
+{
+    drawCalls_ = 0;
+    quads_     = 0;
+}
+
+
+// Number of times target textures have lost their contents
+unsigned int SDL::getTargetResets( )
+{
+    return targetResets_;
+}
+
+
 // Render a copy of a texture
 bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect *dest, ViewInfo &viewInfo, int layoutWidth, int layoutHeight )
 {
@@ -334,19 +580,10 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
     if ( alpha == 0 || viewInfo.Monitor >= numScreens_ || !renderer_[viewInfo.Monitor] )
         return true;
 
-    SDL_GetWindowSize( getWindow( viewInfo.Monitor ), &windowWidth_[viewInfo.Monitor], &windowHeight_[viewInfo.Monitor] );
-
-    float scaleX = (float)windowWidth_[viewInfo.Monitor]  / (float)layoutWidth;
-    float scaleY = (float)windowHeight_[viewInfo.Monitor] / (float)layoutHeight;
-
-    if ( rotation_[viewInfo.Monitor] % 2 == 1 ) // 90 or 270 degree rotation; change scale factors
-    {
-        scaleX = (float)windowHeight_[viewInfo.Monitor] / (float)layoutWidth;
-        scaleY = (float)windowWidth_[viewInfo.Monitor]  / (float)layoutHeight;
-    }
+    RenderContext &context = getRenderContext( viewInfo.Monitor, layoutWidth, layoutHeight );
 
-    if ( mirror_[viewInfo.Monitor] )
-        scaleY /= 2;
+    float scaleX = context.scaleX;
+    float scaleY = context.scaleY;
 
     // Don't print outside the screen in mirror mode
     if ( mirror_[viewInfo.Monitor] && (viewInfo.ContainerWidth < 0 || viewInfo.ContainerHeight < 0) )
@@ -369,16 +606,8 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
     dstRect.w = dest->w;
     dstRect.h = dest->h;
 
-    if ( fullscreen_[viewInfo.Monitor] )
-    {
-        dstRect.x = dest->x + (displayWidth_[viewInfo.Monitor] - windowWidth_[viewInfo.Monitor])/2;
-        dstRect.y = dest->y + (displayHeight_[viewInfo.Monitor] - windowHeight_[viewInfo.Monitor])/2;
-    }
-    else
-    {
-        dstRect.x = dest->x;
-        dstRect.y = dest->y;
-    }
+    dstRect.x = dest->x + context.offsetX;
+    dstRect.y = dest->y + context.offsetY;
 
     // Create the base fields to check against the container.
     if (src)
@@ -461,9 +690,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
 
     }
 
-    double angle = viewInfo.Angle;
-    if ( !mirror_[viewInfo.Monitor] )
-        angle += rotation_[viewInfo.Monitor] * 90;
+    double angle = viewInfo.Angle + context.angle;
 
     dstRect.x = (int)(dstRect.x*scaleX);
     dstRect.y = (int)(dstRect.y*scaleY);
@@ -477,12 +704,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
             if ( srcRect.h > 0 && srcRect.w > 0 )
             {
                 dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_NONE );
+                renderQuad( viewInfo.Monitor, texture, alpha, &srcRect, &dstRect, angle, SDL_FLIP_NONE );
                 dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                 dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                 angle    += 180;
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_NONE );
+                renderQuad( viewInfo.Monitor, texture, alpha, &srcRect, &dstRect, angle, SDL_FLIP_NONE );
             }
         }
         else
@@ -493,12 +719,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                 dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
                 dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
                 angle    += 90;
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_NONE );
+                renderQuad( viewInfo.Monitor, texture, alpha, &srcRect, &dstRect, angle, SDL_FLIP_NONE );
                 dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                 dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                 angle    += 180;
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_NONE );
+                renderQuad( viewInfo.Monitor, texture, alpha, &srcRect, &dstRect, angle, SDL_FLIP_NONE );
             }
         }
     }
@@ -524,8 +749,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
     
         if ( srcRect.h > 0 && srcRect.w > 0 )
         {
-            SDL_SetTextureAlphaMod( texture, static_cast<char>( alpha * 255 ) );
-            SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_NONE );
+            renderQuad( viewInfo.Monitor, texture, alpha, &srcRect, &dstRect, angle, SDL_FLIP_NONE );
         }
     }
 
@@ -594,9 +818,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
 
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
+        angle = viewInfo.Angle + context.angle;
 
         dstRect.x = (int)(dstRect.x*scaleX);
         dstRect.y = (int)(dstRect.y*scaleY);
@@ -610,12 +832,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                 if ( srcRect.h > 0 && srcRect.w > 0 )
                 {
                     dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                 }
             }
             else
@@ -626,12 +847,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                     dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
                     dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
                     angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                 }
             }
         }
@@ -657,8 +877,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
         
             if ( srcRect.h > 0 && srcRect.w > 0 )
             {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
             }
         }
     }
@@ -728,9 +947,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
 
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
+        angle = viewInfo.Angle + context.angle;
 
         dstRect.x = (int)(dstRect.x*scaleX);
         dstRect.y = (int)(dstRect.y*scaleY);
@@ -744,12 +961,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                 if ( srcRect.h > 0 && srcRect.w > 0 )
                 {
                     dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                 }
             }
             else
@@ -760,12 +976,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                     dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
                     dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
                     angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
                 }
             }
         }
@@ -791,8 +1006,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
         
             if ( srcRect.h > 0 && srcRect.w > 0 )
             {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_VERTICAL );
+                renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_VERTICAL );
             }
         }
     }
@@ -862,9 +1076,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
 
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
+        angle = viewInfo.Angle + context.angle;
 
         dstRect.x = (int)(dstRect.x*scaleX);
         dstRect.y = (int)(dstRect.y*scaleY);
@@ -878,12 +1090,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                 if ( srcRect.h > 0 && srcRect.w > 0 )
                 {
                     dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                 }
             }
             else
@@ -894,12 +1105,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                     dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
                     dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
                     angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                 }
             }
         }
@@ -925,8 +1135,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
         
             if ( srcRect.h > 0 && srcRect.w > 0 )
             {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
             }
         }
     }
@@ -996,9 +1205,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
 
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
+        angle = viewInfo.Angle + context.angle;
 
         dstRect.x = (int)(dstRect.x*scaleX);
         dstRect.y = (int)(dstRect.y*scaleY);
@@ -1012,12 +1219,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                 if ( srcRect.h > 0 && srcRect.w > 0 )
                 {
                     dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                 }
             }
             else
@@ -1028,12 +1234,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
                     dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
                     dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
                     angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                     dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
                     dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
                     angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                    renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
                 }
             }
         }
@@ -1059,8 +1264,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect
         
             if ( srcRect.h > 0 && srcRect.w > 0 )
             {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, NULL, SDL_FLIP_HORIZONTAL );
+                renderQuad( viewInfo.Monitor, texture, viewInfo.ReflectionAlpha * alpha, &srcRect, &dstRect, angle, SDL_FLIP_HORIZONTAL );
             }
         }
     }
@@ -17,6 +17,7 @@
 
 
 #include <SDL2/SDL.h>
+#include <atomic>
 #include <string>
 #include "Graphics/ViewInfo.h"
 #include <vector>
@@ -34,6 +35,11 @@ public:
     static SDL_mutex *getMutex( );
     static SDL_Window *getWindow( int index );
     static bool renderCopy( SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect *dest, ViewInfo &viewInfo, int layoutWidth, int layoutHeight );
+    static void flush( );
+    static unsigned int getDrawCalls( );
+    static unsigned int getQuads( );
+    static void resetStats( );
+    static unsigned int getTargetResets( );
     static int getWindowWidth( int index )
     {
         return (index < numDisplays_ ? windowWidth_[index] : windowWidth_[0]);
@@ -56,6 +62,45 @@ public:
     }
 
 private:
+    // Per-monitor values used by renderCopy; recomputed only when the
+    // window is resized or the layout size changes. The event watch can run
+    // on whichever thread pushes the event, so it only sets the atomic flag.
+    struct RenderContext
+    {
+        RenderContext( ) : dirty( true ), layoutWidth( 0 ), layoutHeight( 0 ) { }
+
+        std::atomic<bool> dirty;
+        int    layoutWidth;
+        int    layoutHeight;
+        float  scaleX;
+        float  scaleY;
+        int    offsetX;
+        int    offsetY;
+        double angle;
+    };
+
+    static RenderContext &getRenderContext( int monitor, int layoutWidth, int layoutHeight );
+    static int eventWatch( void *data, SDL_Event *event );
+    static void renderQuad( int monitor, SDL_Texture *texture, float alpha, SDL_Rect *src, SDL_Rect *dest, double angle, SDL_RendererFlip flip );
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    // Quads that share a texture and blend mode, collected so that they can
+    // be submitted with a single SDL_RenderGeometry call.
+    struct RenderBatch
+    {
+        SDL_Texture              *texture;
+        SDL_BlendMode             blendMode;
+        float                     textureWidth;
+        float                     textureHeight;
+        std::vector<SDL_Vertex>   vertices;
+        std::vector<int>          indices;
+    };
+
+    static void flush( int monitor );
+
+    static std::vector<RenderBatch>    batch_;
+#endif
+
     static std::vector<SDL_Window *>   window_;
     static std::vector<SDL_Renderer *> renderer_;
     static SDL_mutex                  *mutex_;
@@ -66,6 +111,11 @@ private:
     static std::vector<bool>           fullscreen_;
     static std::vector<int>            rotation_;
     static std::vector<bool>           mirror_;
+    static std::vector<RenderContext>  renderContext_;
+    static bool                        batching_;
+    static unsigned int                drawCalls_;
+    static unsigned int                quads_;
+    static std::atomic<unsigned int>   targetResets_;
     static int                         numScreens_;
     static int                         numDisplays_;
 };
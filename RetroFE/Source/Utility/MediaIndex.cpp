@@ -0,0 +1,305 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MediaIndex.h"
+#include "Utils.h"
+#include "Log.h"
+#include "../Database/DB.h"
+#include <dirent.h>
+#include <sqlite3.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sstream>
+
+std::map<std::string, MediaIndex::Directory> MediaIndex::directories_;
+SDL_mutex                                   *MediaIndex::mutex_ = NULL;
+
+
+void MediaIndex::initialize()
+{
+    if(!mutex_)
+    {
+        mutex_ = SDL_CreateMutex();
+    }
+}
+
+
+void MediaIndex::deInitialize()
+{
+    directories_.clear();
+
+    if(mutex_)
+    {
+        SDL_DestroyMutex(mutex_);
+        mutex_ = NULL;
+    }
+}
+
+
+bool MediaIndex::isEnabled()
+{
+    return mutex_ != NULL;
+}
+
+
+// Find directory/name.<extension>, trying the extensions in order. Names and
+// extensions are matched case insensitively.
+bool MediaIndex::findFile(std::string directory, std::string name, std::vector<std::string> &extensions, std::string &file)
+{
+    bool found = false;
+    Uint32 now = SDL_GetTicks();
+
+    SDL_LockMutex(mutex_);
+
+    std::map<std::string, Directory>::iterator it = directories_.find(directory);
+    if(it == directories_.end())
+    {
+        Directory &dir = directories_[directory];
+        dir.mtime   = modificationTime(directory);
+        dir.checked = now;
+        dir.stale   = false;
+        scan(directory, dir);
+        it = directories_.find(directory);
+    }
+    else if(it->second.stale || now - it->second.checked > RECHECK_INTERVAL)
+    {
+        it->second.checked = now;
+        it->second.stale   = false;
+        time_t mtime = modificationTime(directory);
+        if(mtime != it->second.mtime)
+        {
+            it->second.mtime = mtime;
+            scan(directory, it->second);
+        }
+    }
+
+    FileMap::iterator match = it->second.files.find(Utils::toLower(name));
+    if(match != it->second.files.end())
+    {
+        for(unsigned int i = 0; i < extensions.size() && !found; ++i)
+        {
+            std::map<std::string, std::string>::iterator ext = match->second.find(Utils::toLower(extensions[i]));
+            if(ext != match->second.end())
+            {
+                file  = Utils::combinePath(directory, ext->second);
+                found = true;
+            }
+        }
+    }
+
+    SDL_UnlockMutex(mutex_);
+
+    return found;
+}
+
+
+// Read every directory again on its next lookup, whatever its time says
+void MediaIndex::refresh()
+{
+    if(!mutex_) return;
+
+    SDL_LockMutex(mutex_);
+    for(std::map<std::string, Directory>::iterator it = directories_.begin(); it != directories_.end(); ++it)
+    {
+        it->second.mtime = static_cast<time_t>(-1);
+        it->second.stale = true;
+    }
+    SDL_UnlockMutex(mutex_);
+}
+
+
+// Restore the listings saved by a previous run. Each one is checked against
+// its directory's modification time the first time it is used.
+void MediaIndex::load(DB &db)
+{
+    sqlite3 *handle = db.handle;
+    sqlite3_stmt *stmt;
+    char *error = NULL;
+
+    if(!mutex_) return;
+
+    if(sqlite3_exec(handle, "CREATE TABLE IF NOT EXISTS MediaIndex(directory TEXT PRIMARY KEY, mtime INTEGER, files TEXT);", NULL, 0, &error) != SQLITE_OK)
+    {
+        std::string message = (error) ? error : "";
+        Logger::write(Logger::ZONE_WARNING, "MediaIndex", "Unable to create media index table: " + message);
+        sqlite3_free(error);
+        return;
+    }
+
+    if(sqlite3_prepare_v2(handle, "SELECT directory, mtime, files FROM MediaIndex;", -1, &stmt, 0) != SQLITE_OK)
+    {
+        return;
+    }
+
+    SDL_LockMutex(mutex_);
+    while(sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        const char *path  = (const char *)sqlite3_column_text(stmt, 0);
+        const char *files = (const char *)sqlite3_column_text(stmt, 2);
+        if(!path || directories_.find(path) != directories_.end()) continue;
+
+        Directory &dir = directories_[path];
+        dir.mtime   = static_cast<time_t>(sqlite3_column_int64(stmt, 1));
+        dir.checked = 0;
+        dir.stale   = true;
+        dir.dirty   = false;
+        dir.missing = false;
+
+        std::stringstream ss(files ? files : "");
+        std::string file;
+        while(std::getline(ss, file))
+        {
+            addFile(dir, file);
+        }
+    }
+    Logger::write(Logger::ZONE_INFO, "MediaIndex", "Loaded " + std::to_string(directories_.size()) + " directories from the media manifest");
+    SDL_UnlockMutex(mutex_);
+
+    sqlite3_finalize(stmt);
+}
+
+
+// Store the listings that were read during this run, and drop the rows of
+// directories that were gone when they were read again
+void MediaIndex::save(DB &db)
+{
+    sqlite3 *handle = db.handle;
+    sqlite3_stmt *stmt;
+    sqlite3_stmt *remove;
+    char *error = NULL;
+    int count = 0;
+    int removed = 0;
+
+    if(!mutex_) return;
+
+    if(sqlite3_prepare_v2(handle, "INSERT OR REPLACE INTO MediaIndex(directory, mtime, files) VALUES(?, ?, ?);", -1, &stmt, 0) != SQLITE_OK)
+    {
+        return;
+    }
+    if(sqlite3_prepare_v2(handle, "DELETE FROM MediaIndex WHERE directory = ?;", -1, &remove, 0) != SQLITE_OK)
+    {
+        sqlite3_finalize(stmt);
+        return;
+    }
+
+    SDL_LockMutex(mutex_);
+    sqlite3_exec(handle, "BEGIN IMMEDIATE TRANSACTION;", NULL, NULL, &error);
+    for(std::map<std::string, Directory>::iterator it = directories_.begin(); it != directories_.end(); ++it)
+    {
+        if(!it->second.dirty) continue;
+
+        if(it->second.missing)
+        {
+            sqlite3_bind_text(remove, 1, it->first.c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_step(remove);
+            sqlite3_reset(remove);
+
+            it->second.dirty = false;
+            removed++;
+            continue;
+        }
+
+        std::string files;
+        for(FileMap::iterator name = it->second.files.begin(); name != it->second.files.end(); ++name)
+        {
+            for(std::map<std::string, std::string>::iterator ext = name->second.begin(); ext != name->second.end(); ++ext)
+            {
+                files += ext->second + "\n";
+            }
+        }
+
+        sqlite3_bind_text(stmt, 1, it->first.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int64(stmt, 2, static_cast<sqlite3_int64>(it->second.mtime));
+        sqlite3_bind_text(stmt, 3, files.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+
+        it->second.dirty = false;
+        count++;
+    }
+    sqlite3_exec(handle, "COMMIT TRANSACTION;", NULL, NULL, &error);
+    SDL_UnlockMutex(mutex_);
+
+    sqlite3_finalize(stmt);
+    sqlite3_finalize(remove);
+
+    if(count > 0)
+    {
+        Logger::write(Logger::ZONE_INFO, "MediaIndex", "Saved " + std::to_string(count) + " directories to the media manifest");
+    }
+    if(removed > 0)
+    {
+        Logger::write(Logger::ZONE_INFO, "MediaIndex", "Removed " + std::to_string(removed) + " missing directories from the media manifest");
+    }
+}
+
+
+time_t MediaIndex::modificationTime(std::string path)
+{
+    struct stat sb;
+
+    if(stat(path.c_str(), &sb) != 0)
+    {
+        return 0;
+    }
+
+    return sb.st_mtime;
+}
+
+
+void MediaIndex::scan(std::string path, Directory &directory)
+{
+    DIR *dp;
+    struct dirent *dirp;
+
+    directory.files.clear();
+    directory.dirty = true;
+
+    dp = opendir(path.c_str());
+    directory.missing = (dp == NULL);
+
+    while(dp != NULL && (dirp = readdir(dp)) != NULL)
+    {
+        addFile(directory, dirp->d_name);
+    }
+
+    if(dp)
+    {
+        closedir(dp);
+        Logger::write(Logger::ZONE_DEBUG, "MediaIndex", "Indexed " + std::to_string(directory.files.size()) + " names in " + path);
+    }
+}
+
+
+void MediaIndex::addFile(Directory &directory, std::string file)
+{
+    size_t dot = file.find_last_of(".");
+
+    if(dot == std::string::npos || dot == 0)
+    {
+        return;
+    }
+
+    std::string basename  = Utils::toLower(file.substr(0, dot));
+    std::string extension = Utils::toLower(file.substr(dot + 1));
+
+    // keep the first file found when names differ only in case
+    std::map<std::string, std::string> &extensions = directory.files[basename];
+    if(extensions.find(extension) == extensions.end())
+    {
+        extensions[extension] = file;
+    }
+}
@@ -0,0 +1,64 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+class DB;
+
+// In-memory listing of the media directories. Each directory is read once
+// and then answers file lookups without touching the disk; it is read again
+// when its modification time changes or after refresh(). The listings are
+// kept in meta.db between runs, so a cold start only reads the directories
+// that changed, and the rows of directories found missing are dropped.
+class MediaIndex
+{
+public:
+    static void initialize();
+    static void deInitialize();
+    static bool isEnabled();
+    static bool findFile(std::string directory, std::string name, std::vector<std::string> &extensions, std::string &file);
+    static void refresh();
+    static void load(DB &db);
+    static void save(DB &db);
+
+private:
+    // lowercase base name -> lowercase extension -> file name on disk
+    typedef std::map<std::string, std::map<std::string, std::string> > FileMap;
+
+    struct Directory
+    {
+        time_t  mtime;
+        Uint32  checked;
+        bool    stale;
+        bool    dirty;
+        bool    missing;
+        FileMap files;
+    };
+
+    static time_t modificationTime(std::string path);
+    static void scan(std::string path, Directory &directory);
+    static void addFile(Directory &directory, std::string file);
+
+    static const Uint32 RECHECK_INTERVAL = 2000;
+
+    static std::map<std::string, Directory> directories_;
+    static SDL_mutex                       *mutex_;
+};
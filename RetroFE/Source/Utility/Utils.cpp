@@ -15,6 +15,7 @@
  */
 
 #include "Utils.h"
+#include "MediaIndex.h"
 #include "../Database/Configuration.h"
 #include "Log.h"
 #include <algorithm>
@@ -54,6 +55,46 @@ std::string Utils::uppercaseFirst(std::string str)
 
     return str;
 }
+// Decode a UTF-8 string into code points. Bytes that are not part of a
+// valid sequence are taken to be Latin-1, as in older text files.
+void Utils::decodeUtf8( const std::string &str, std::vector<unsigned int> &codes )
+{
+    codes.clear( );
+    codes.reserve( str.size( ) );
+
+    for ( unsigned int i = 0; i < str.size( ); )
+    {
+        unsigned char c      = static_cast<unsigned char>( str[i] );
+        unsigned int  code   = c;
+        unsigned int  length = 1;
+        unsigned int  min    = 0;
+
+        if      ( c >= 0xF0 && c < 0xF5 ) { length = 4; code = c & 0x07; min = 0x10000; }
+        else if ( c >= 0xE0 )             { length = 3; code = c & 0x0F; min = 0x800; }
+        else if ( c >= 0xC2 )             { length = 2; code = c & 0x1F; min = 0x80; }
+
+        bool valid = (length == 1 || (i + length <= str.size( ) && c < 0xF5));
+        for ( unsigned int n = 1; valid && n < length; ++n )
+        {
+            unsigned char next = static_cast<unsigned char>( str[i + n] );
+            valid = ((next & 0xC0) == 0x80);
+            code  = (code << 6) | (next & 0x3F);
+        }
+
+        if ( valid && code >= min && code <= 0x10FFFF && (code < 0xD800 || code > 0xDFFF) )
+        {
+            codes.push_back( code );
+            i += length;
+        }
+        else
+        {
+            codes.push_back( c );
+            i += 1;
+        }
+    }
+}
+
+
 std::string Utils::filterComments(std::string line)
 {
     size_t position;
@@ -131,6 +172,12 @@ std::string Utils::combinePath(std::string path1, std::string path2, std::string
 
 bool Utils::findMatchingFile(std::string prefix, std::vector<std::string> &extensions, std::string &file)
 {
+    if(MediaIndex::isEnabled())
+    {
+        std::string path = Configuration::convertToAbsolutePath(Configuration::absolutePath, prefix);
+        return MediaIndex::findFile(getDirectory(path), getFileName(path), extensions, file);
+    }
+
     for(unsigned int i = 0; i < extensions.size(); ++i)
     {
         std::string temp = prefix + "." + extensions[i];
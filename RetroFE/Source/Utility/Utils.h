@@ -37,6 +37,7 @@ public:
     static std::string trimEnds(std::string str);
     static void listToVector( std::string str, std::vector<std::string> &vec, char delimiter );
     static int gcd( int a, int b );
+    static void decodeUtf8( const std::string &str, std::vector<unsigned int> &codes );
 
     //todo: there has to be a better way to do this
     static std::string combinePath(std::list<std::string> &paths);
@@ -24,11 +24,12 @@
 #include <cstring>
 #include <cstdlib>
 #include <cstdio>
+#include <cmath>
+#include <algorithm>
 #include <SDL2/SDL.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <gst/app/gstappsink.h>
-#include <gst/video/gstvideometa.h>
 #include <gst/video/video.h>
 #include <gst/audio/audio.h>
 
@@ -39,61 +40,182 @@ GStreamerVideo::GStreamerVideo( int monitor )
     , videoBin_(NULL)
     , videoSink_(NULL)
     , videoConvert_(NULL)
+    , videoScale_(NULL)
     , videoConvertCaps_(NULL)
     , videoBus_(NULL)
     , texture_(NULL)
     , height_(0)
     , width_(0)
-    , videoBuffer_(NULL)
-    , frameReady_(false)
+    , sourceHeight_(0)
+    , sourceWidth_(0)
+    , targetWidth_(0)
+    , targetHeight_(0)
+    , scaleStepX_(SCALE_STEPS)
+    , scaleStepY_(SCALE_STEPS)
+    , pendingStepX_(SCALE_STEPS)
+    , pendingStepY_(SCALE_STEPS)
+    , stableFrames_(0)
+    , videoCaps_(NULL)
     , isPlaying_(false)
     , playCount_(0)
     , numLoops_(0)
     , volume_(0.0)
     , currentVolume_(0.0)
     , monitor_(monitor)
+    , visible_(true)
+    , uploadTime_(0)
+    , uploadCount_(0)
+    , playStart_(0)
+    , awaitingFrame_(false)
+    , reused_(false)
+    , prerolled_(false)
+    , fromPreroll_(false)
 {
     paused_ = false;
+    SDL_AtomicSet(&decodedCount_, 0);
 }
 GStreamerVideo::~GStreamerVideo()
 {
     stop();
+
+    if(playbin_)
+    {
+        (void)gst_element_set_state(playbin_, GST_STATE_NULL);
+    }
+    freeElements();
 }
 
 void GStreamerVideo::setNumLoops(int n)
 {
-    if ( n > 0 )
+    if ( n >= 0 )
         numLoops_ = n;
 }
 
+int GStreamerVideo::getMonitor()
+{
+    return monitor_;
+}
+
 SDL_Texture *GStreamerVideo::getTexture() const
 {
     return texture_;
 }
 
-void GStreamerVideo::processNewBuffer (GstElement * /* fakesink */, GstBuffer *buf, GstPad *new_pad, gpointer userdata)
+// Counts the frames that reach the sink, on a GStreamer streaming thread
+GstPadProbeReturn GStreamerVideo::countFrame(GstPad * /* pad */, GstPadProbeInfo * /* info */, gpointer userdata)
 {
     GStreamerVideo *video = (GStreamerVideo *)userdata;
 
-    SDL_LockMutex(SDL::getMutex());
-    if (!video->frameReady_ && video && video->isPlaying_)
+    SDL_AtomicAdd(&video->decodedCount_, 1);
+
+    return GST_PAD_PROBE_OK;
+}
+
+
+// Read the frame layout from the caps of a sample, when they change
+bool GStreamerVideo::readVideoInfo(GstCaps *caps)
+{
+    if(videoCaps_ && gst_caps_is_equal(caps, videoCaps_))
     {
-        if(!video->width_ || !video->height_)
-        {
-            GstCaps *caps = gst_pad_get_current_caps (new_pad);
-            GstStructure *s = gst_caps_get_structure(caps, 0);
+        return true;
+    }
 
-            gst_structure_get_int(s, "width", &video->width_);
-            gst_structure_get_int(s, "height", &video->height_);
-        }
+    GstVideoInfo info;
+    if(!gst_video_info_from_caps(&info, caps))
+    {
+        return false;
+    }
+
+    if(videoCaps_)
+    {
+        gst_caps_unref(videoCaps_);
+    }
+    videoCaps_ = gst_caps_ref(caps);
+
+    if(texture_ && (GST_VIDEO_INFO_WIDTH(&info) != width_ || GST_VIDEO_INFO_HEIGHT(&info) != height_))
+    {
+        SDL_DestroyTexture(texture_);
+        texture_ = NULL;
+    }
 
-        if(video->height_ && video->width_ && !video->videoBuffer_)
+    videoInfo_ = info;
+    width_     = GST_VIDEO_INFO_WIDTH(&info);
+    height_    = GST_VIDEO_INFO_HEIGHT(&info);
+
+    // The size before scaling is what the layout sees
+    sourceWidth_  = width_;
+    sourceHeight_ = height_;
+    GstPad *pad = gst_element_get_static_pad(videoScale_, "sink");
+    if(pad)
+    {
+        GstCaps *sourceCaps = gst_pad_get_current_caps(pad);
+        GstVideoInfo sourceInfo;
+        if(sourceCaps && gst_video_info_from_caps(&sourceInfo, sourceCaps))
         {
-            video->videoBuffer_ = gst_buffer_ref(buf);
-            video->frameReady_ = true;
+            sourceWidth_  = GST_VIDEO_INFO_WIDTH(&sourceInfo);
+            sourceHeight_ = GST_VIDEO_INFO_HEIGHT(&sourceInfo);
         }
+        if(sourceCaps)
+        {
+            gst_caps_unref(sourceCaps);
+        }
+        gst_object_unref(pad);
     }
-    SDL_UnlockMutex(SDL::getMutex());
+
+    return true;
+}
+
+
+// Have the pipeline scale the video down to about the size it is shown at,
+// so decoding is followed by copies and uploads of that size only. While the
+// shown size is still changing the current caps are kept.
+void GStreamerVideo::updateScale()
+{
+    if(!videoConvert_ || sourceWidth_ <= 0 || sourceHeight_ <= 0 || targetWidth_ <= 0 || targetHeight_ <= 0)
+    {
+        return;
+    }
+
+    int stepX = static_cast<int>(ceil(static_cast<double>(targetWidth_) * SCALE_STEPS / sourceWidth_));
+    int stepY = static_cast<int>(ceil(static_cast<double>(targetHeight_) * SCALE_STEPS / sourceHeight_));
+    stepX = std::max(1, std::min(SCALE_STEPS, stepX));
+    stepY = std::max(1, std::min(SCALE_STEPS, stepY));
+    if(stepX == scaleStepX_ && stepY == scaleStepY_)
+    {
+        pendingStepX_ = stepX;
+        pendingStepY_ = stepY;
+        stableFrames_ = 0;
+        return;
+    }
+    if(stepX != pendingStepX_ || stepY != pendingStepY_)
+    {
+        pendingStepX_ = stepX;
+        pendingStepY_ = stepY;
+        stableFrames_ = 0;
+        return;
+    }
+    if(++stableFrames_ < SCALE_STABLE_FRAMES)
+    {
+        return;
+    }
+    stableFrames_ = 0;
+    scaleStepX_ = stepX;
+    scaleStepY_ = stepY;
+
+    GstCaps *caps;
+    if(stepX == SCALE_STEPS && stepY == SCALE_STEPS)
+    {
+        caps = gst_caps_from_string("video/x-raw");
+    }
+    else
+    {
+        // I420 needs even sizes
+        int width  = std::max(2, (sourceWidth_ * stepX / SCALE_STEPS) & ~1);
+        int height = std::max(2, (sourceHeight_ * stepY / SCALE_STEPS) & ~1);
+        caps = gst_caps_new_simple("video/x-raw", "width", G_TYPE_INT, width, "height", G_TYPE_INT, height, NULL);
+    }
+    g_object_set(G_OBJECT(videoConvert_), "caps", caps, NULL);
+    gst_caps_unref(caps);
 }
 
 
@@ -137,14 +259,17 @@ bool GStreamerVideo::stop()
         return false;
     }
     
-    if(videoSink_)
+    // Keep the pipeline in READY so that it can be given another file
+    // without building it again; the destructor takes it down
+    if(playbin_)
     {
-        g_object_set(G_OBJECT(videoSink_), "signal-handoffs", FALSE, NULL);
+        (void)gst_element_set_state(playbin_, GST_STATE_READY);
     }
-
-    if(playbin_)
+    if(videoConvert_)
     {
-        (void)gst_element_set_state(playbin_, GST_STATE_NULL);
+        GstCaps *caps = gst_caps_from_string("video/x-raw");
+        g_object_set(G_OBJECT(videoConvert_), "caps", caps, NULL);
+        gst_caps_unref(caps);
     }
 
     if(texture_)
@@ -153,23 +278,90 @@ bool GStreamerVideo::stop()
         texture_ = NULL;
     }
 
-    if(videoBuffer_)
+    if(videoCaps_)
     {
-        gst_buffer_unref(videoBuffer_);
-        videoBuffer_ = NULL;
+        gst_caps_unref(videoCaps_);
+        videoCaps_ = NULL;
     }
 
-    freeElements();
+    // Frames produced by the streaming thread and consumed by the renderer;
+    // the dropped ones were never pulled, because they were replaced by a
+    // newer one or the video could not be seen
+    int decoded = SDL_AtomicGet(&decodedCount_);
+    if(decoded > 0)
+    {
+        double ms = uploadCount_ ? uploadTime_ * 1000.0 / SDL_GetPerformanceFrequency() / uploadCount_ : 0;
+        std::stringstream ss;
+        ss << currentFile_ << ": produced " << decoded << " frames, consumed " << uploadCount_
+           << ", dropped " << decoded - static_cast<int>(uploadCount_) << "; " << ms << " ms per upload";
+        Logger::write(Logger::ZONE_DEBUG, "Video", ss.str());
+    }
+    SDL_AtomicSet(&decodedCount_, 0);
+    uploadTime_  = 0;
+    uploadCount_ = 0;
+    awaitingFrame_ = false;
+    prerolled_ = false;
 
     isPlaying_ = false;
+    currentVolume_ = 0.0;
     height_ = 0;
     width_ = 0;
-    frameReady_ = false;
+    sourceHeight_ = 0;
+    sourceWidth_ = 0;
+    scaleStepX_ = SCALE_STEPS;
+    scaleStepY_ = SCALE_STEPS;
+    pendingStepX_ = SCALE_STEPS;
+    pendingStepY_ = SCALE_STEPS;
+    stableFrames_ = 0;
 
     return true;
 }
 
 bool GStreamerVideo::play(std::string file)
+{
+    // A pipeline prerolled with this file only needs to be set going
+    if(prerolled_ && playbin_ && file == currentFile_)
+    {
+        prerolled_ = false;
+        if(gst_element_set_state(GST_ELEMENT(playbin_), GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE)
+        {
+            isPlaying_ = true;
+            playStart_ = SDL_GetPerformanceCounter();
+            awaitingFrame_ = true;
+            fromPreroll_ = true;
+            return true;
+        }
+    }
+
+    fromPreroll_ = false;
+    return load(file, GST_STATE_PLAYING);
+}
+
+
+// Decode up to the first frame and wait in PAUSED, with the sound muted,
+// so that a later play() of the same file starts right away
+bool GStreamerVideo::preroll(std::string file)
+{
+    if(!load(file, GST_STATE_PAUSED))
+    {
+        return false;
+    }
+
+    isPlaying_ = false;
+    awaitingFrame_ = false;
+    prerolled_ = true;
+
+    return true;
+}
+
+
+bool GStreamerVideo::isPrerolled(std::string file)
+{
+    return prerolled_ && file == currentFile_;
+}
+
+
+bool GStreamerVideo::load(std::string file, GstState state)
 {
 
     playCount_ = 0;
@@ -190,12 +382,14 @@ bool GStreamerVideo::play(std::string file)
     }
     else
     {
+        reused_ = (playbin_ != NULL);
         if(!playbin_)
         {
             playbin_ = gst_element_factory_make("playbin3", "player");
             videoBin_ = gst_bin_new("SinkBin");
-            videoSink_  = gst_element_factory_make("fakesink", "video_sink");
+            videoSink_  = gst_element_factory_make("appsink", "video_sink");
             videoConvert_  = gst_element_factory_make("capsfilter", "video_convert");
+            videoScale_  = gst_element_factory_make("videoscale", "video_scale");
             videoConvertCaps_ = gst_caps_from_string("video/x-raw,format=(string)I420,pixel-aspect-ratio=(fraction)1/1");
             height_ = 0;
             width_ = 0;
@@ -217,6 +411,12 @@ bool GStreamerVideo::play(std::string file)
                 freeElements();
                 return false;
             }
+            if(!videoScale_)
+            {
+                Logger::write(Logger::ZONE_DEBUG, "Video", "Could not create video scaler");
+                freeElements();
+                return false;
+            }
             if(!videoConvertCaps_)
             {
                 Logger::write(Logger::ZONE_DEBUG, "Video", "Could not create video caps");
@@ -224,9 +424,14 @@ bool GStreamerVideo::play(std::string file)
                 return false;
             }
 
-            gst_bin_add_many(GST_BIN(videoBin_), videoConvert_, videoSink_, NULL);
+            // Stretch to the requested size like the renderer would, rather
+            // than adding borders to keep the aspect ratio
+            g_object_set(G_OBJECT(videoScale_), "add-borders", FALSE, NULL);
+
+            gst_bin_add_many(GST_BIN(videoBin_), videoScale_, videoConvert_, videoSink_, NULL);
+            gst_element_link(videoScale_, videoConvert_);
             gst_element_link_filtered(videoConvert_, videoSink_, videoConvertCaps_);
-            GstPad *videoConvertSinkPad = gst_element_get_static_pad(videoConvert_, "sink");
+            GstPad *videoConvertSinkPad = gst_element_get_static_pad(videoScale_, "sink");
 
             if(!videoConvertSinkPad)
             {
@@ -235,7 +440,20 @@ bool GStreamerVideo::play(std::string file)
                 return false;
             }
 
-            g_object_set(G_OBJECT(videoSink_), "sync", TRUE, "qos", FALSE, NULL);
+            // The sink is the handoff between the streaming thread and the
+            // renderer: it holds one frame and replaces it with each newer
+            // one, so the latest frame wins and neither side ever waits on
+            // the global SDL mutex. The renderer pulls the frame when it draws.
+            g_object_set(G_OBJECT(videoSink_), "sync", TRUE, "qos", FALSE, "enable-last-sample", FALSE, NULL);
+            gst_app_sink_set_max_buffers(GST_APP_SINK(videoSink_), 1);
+            gst_app_sink_set_drop(GST_APP_SINK(videoSink_), TRUE);
+
+            GstPad *appSinkPad = gst_element_get_static_pad(videoSink_, "sink");
+            if(appSinkPad)
+            {
+                gst_pad_add_probe(appSinkPad, GST_PAD_PROBE_TYPE_BUFFER, countFrame, this, NULL);
+                gst_object_unref(appSinkPad);
+            }
 
             GstPad *videoSinkPad = gst_ghost_pad_new("sink", videoConvertSinkPad);
             if(!videoSinkPad)
@@ -250,44 +468,55 @@ bool GStreamerVideo::play(std::string file)
             gst_element_add_pad(videoBin_, videoSinkPad);
             gst_object_unref(videoConvertSinkPad);
             videoConvertSinkPad = NULL;
-        }
-        g_object_set(G_OBJECT(playbin_), "uri", uriFile, "video-sink", videoBin_, NULL);
-        g_free( uriFile );
 
-        isPlaying_ = true;
-        
-        g_signal_connect(playbin_, "element-setup", G_CALLBACK(+[](GstElement *playbin, GstElement *element, gpointer data) {
-        GStreamerVideo *video = static_cast<GStreamerVideo *>(data);
+            g_object_set(G_OBJECT(playbin_), "video-sink", videoBin_, NULL);
 
-        if (video)
-        {
-            gchar *elementName = gst_element_get_name(element);
+            g_signal_connect(playbin_, "element-setup", G_CALLBACK(+[](GstElement *playbin, GstElement *element, gpointer data) {
+            GStreamerVideo *video = static_cast<GStreamerVideo *>(data);
 
-                if (g_str_has_prefix(elementName, "avdec_h264"))
-                {
-                    // Modify the properties of the avdec_h264 element here
-                    // set "thread-type" property to 2
-                    g_object_set(G_OBJECT(element), "thread-type", 2, NULL);
-                }
+            if (video)
+            {
+                gchar *elementName = gst_element_get_name(element);
 
-            g_free(elementName);
-        }
-        }), this);
+                    if (g_str_has_prefix(elementName, "avdec_h264"))
+                    {
+                        // Modify the properties of the avdec_h264 element here
+                        // set "thread-type" property to 2
+                        g_object_set(G_OBJECT(element), "thread-type", 2, NULL);
+                    }
 
-        g_object_set(G_OBJECT(videoSink_), "signal-handoffs", TRUE, NULL);
-        g_signal_connect(videoSink_, "handoff", G_CALLBACK(processNewBuffer), this);
+                g_free(elementName);
+            }
+            }), this);
+
+            videoBus_ = gst_pipeline_get_bus(GST_PIPELINE(playbin_));
+        }
+        else
+        {
+            // Drop what the previous file left on the bus
+            GstMessage *msg;
+            while(videoBus_ && (msg = gst_bus_pop(videoBus_)) != NULL)
+            {
+                gst_message_unref(msg);
+            }
+        }
+        g_object_set(G_OBJECT(playbin_), "uri", uriFile, NULL);
+        g_free( uriFile );
 
-        videoBus_ = gst_pipeline_get_bus(GST_PIPELINE(playbin_));
+        isPlaying_ = true;
+        playStart_ = SDL_GetPerformanceCounter();
+        awaitingFrame_ = true;
 
         /* Start playing */
-        GstStateChangeReturn playState = gst_element_set_state(GST_ELEMENT(playbin_), GST_STATE_PLAYING);
+        GstStateChangeReturn playState = gst_element_set_state(GST_ELEMENT(playbin_), state);
         if (playState != GST_STATE_CHANGE_ASYNC)
         {
             isPlaying_ = false;
             std::stringstream ss;
-            ss << "Unable to set the pipeline to the playing state: ";
+            ss << "Unable to set the pipeline to the " << (state == GST_STATE_PLAYING ? "playing" : "paused") << " state: ";
             ss << playState;
             Logger::write(Logger::ZONE_ERROR, "Video", ss.str());
+            (void)gst_element_set_state(playbin_, GST_STATE_NULL);
             freeElements();
             return false;
         }
@@ -318,29 +547,55 @@ void GStreamerVideo::freeElements()
     }
     videoSink_    = NULL;
     videoConvert_ = NULL;
+    videoScale_   = NULL;
     videoBin_     = NULL;
 }
 
 
 int GStreamerVideo::getHeight()
 {
-    return static_cast<int>(height_);
+    return static_cast<int>(sourceHeight_);
 }
 
 int GStreamerVideo::getWidth()
 {
-    return static_cast<int>(width_);
+    return static_cast<int>(sourceWidth_);
+}
+
+// Size of the texture frames are uploaded to, which is smaller than the
+// source when the pipeline scales the video down
+int GStreamerVideo::getTextureHeight()
+{
+    return texture_ ? static_cast<int>(height_) : 0;
+}
+
+int GStreamerVideo::getTextureWidth()
+{
+    return texture_ ? static_cast<int>(width_) : 0;
 }
 
 
 void GStreamerVideo::draw()
 {
-    frameReady_ = false;
 }
 
 void GStreamerVideo::update(float /* dt */)
 {
     SDL_LockMutex(SDL::getMutex());
+
+    // Pull the newest frame only when it is going to be drawn; while the
+    // video cannot be seen the sink keeps replacing its single frame
+    GstSample *sample = NULL;
+    if(videoSink_ && visible_)
+    {
+        sample = gst_app_sink_try_pull_sample(GST_APP_SINK(videoSink_), 0);
+    }
+    if(sample && gst_sample_get_caps(sample))
+    {
+        readVideoInfo(gst_sample_get_caps(sample));
+    }
+    updateScale();
+
     if(!texture_ && width_ != 0 && height_ != 0)
     {
         texture_ = SDL_CreateTexture(SDL::getRenderer(monitor_), SDL_PIXELFORMAT_IYUV,
@@ -363,66 +618,14 @@ void GStreamerVideo::update(float /* dt */)
 			gst_stream_volume_set_mute( GST_STREAM_VOLUME( playbin_ ), false );
 	}
 
-    if(videoBuffer_)
+    if(sample)
     {
-        GstVideoMeta *meta;
-        meta = gst_buffer_get_video_meta(videoBuffer_);
-
-        // Presence of meta indicates non-contiguous data in the buffer
-        if (!meta)
+        GstBuffer *buffer = gst_sample_get_buffer(sample);
+        if(buffer && texture_)
         {
-            void *pixels;
-            int pitch;
-            unsigned int vbytes = width_ * height_;
-            vbytes += (vbytes / 2);
-            gsize bufSize = gst_buffer_get_size(videoBuffer_);
-
-            if (bufSize == vbytes)
-            {
-                SDL_LockTexture(texture_, NULL, &pixels, &pitch);
-                gst_buffer_extract(videoBuffer_, 0, pixels, vbytes);
-                SDL_UnlockTexture(texture_);
-            }
-            else
-            {
-                GstMapInfo bufInfo;
-                unsigned int y_stride, u_stride, v_stride;
-                const Uint8 *y_plane, *u_plane, *v_plane;
-
-                y_stride = GST_ROUND_UP_4(width_);
-                u_stride = v_stride = GST_ROUND_UP_4(y_stride / 2);
-
-                gst_buffer_map(videoBuffer_, &bufInfo, GST_MAP_READ);
-                y_plane = bufInfo.data;
-                u_plane = y_plane + (height_ * y_stride);
-                v_plane = u_plane + ((height_ / 2) * u_stride);
-                SDL_UpdateYUVTexture(texture_, NULL,
-                                     (const Uint8*)y_plane, y_stride,
-                                     (const Uint8*)u_plane, u_stride,
-                                     (const Uint8*)v_plane, v_stride);
-                gst_buffer_unmap(videoBuffer_, &bufInfo);
-            }
+            uploadFrame(buffer);
         }
-        else
-        {
-            GstMapInfo y_info, u_info, v_info;
-            void *y_plane, *u_plane, *v_plane;
-            int y_stride, u_stride, v_stride;
-
-            gst_video_meta_map(meta, 0, &y_info, &y_plane, &y_stride, GST_MAP_READ);
-            gst_video_meta_map(meta, 1, &u_info, &u_plane, &u_stride, GST_MAP_READ);
-            gst_video_meta_map(meta, 2, &v_info, &v_plane, &v_stride, GST_MAP_READ);
-            SDL_UpdateYUVTexture(texture_, NULL,
-                                 (const Uint8*)y_plane, y_stride,
-                                 (const Uint8*)u_plane, u_stride,
-                                 (const Uint8*)v_plane, v_stride);
-            gst_video_meta_unmap(meta, 0, &y_info);
-            gst_video_meta_unmap(meta, 1, &u_info);
-            gst_video_meta_unmap(meta, 2, &v_info);
-        }
-
-        gst_buffer_unref(videoBuffer_);
-        videoBuffer_ = NULL;
+        gst_sample_unref(sample);
     }
 
     if(videoBus_)
@@ -460,6 +663,39 @@ void GStreamerVideo::update(float /* dt */)
 }
 
 
+// Upload the planes straight from the mapped buffer; mapping through the
+// video info honours the strides and offsets of the decoder, whether or not
+// it attached video meta to the buffer
+void GStreamerVideo::uploadFrame(GstBuffer *buffer)
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    GstVideoFrame frame;
+    if(!gst_video_frame_map(&frame, &videoInfo_, buffer, GST_MAP_READ))
+    {
+        return;
+    }
+
+    SDL_UpdateYUVTexture(texture_, NULL,
+                         static_cast<const Uint8 *>(GST_VIDEO_FRAME_PLANE_DATA(&frame, 0)), GST_VIDEO_FRAME_PLANE_STRIDE(&frame, 0),
+                         static_cast<const Uint8 *>(GST_VIDEO_FRAME_PLANE_DATA(&frame, 1)), GST_VIDEO_FRAME_PLANE_STRIDE(&frame, 1),
+                         static_cast<const Uint8 *>(GST_VIDEO_FRAME_PLANE_DATA(&frame, 2)), GST_VIDEO_FRAME_PLANE_STRIDE(&frame, 2));
+    gst_video_frame_unmap(&frame);
+
+    uploadTime_ += SDL_GetPerformanceCounter() - start;
+    uploadCount_++;
+
+    if(awaitingFrame_)
+    {
+        awaitingFrame_ = false;
+        double ms = (SDL_GetPerformanceCounter() - playStart_) * 1000.0 / SDL_GetPerformanceFrequency();
+        std::stringstream ss;
+        ss << currentFile_ << ": first frame after " << ms << " ms (" << (fromPreroll_ ? "prerolled" : reused_ ? "reused" : "new") << " pipeline)";
+        Logger::write(Logger::ZONE_DEBUG, "Video", ss.str());
+    }
+}
+
+
 bool GStreamerVideo::isPlaying()
 {
     return isPlaying_;
@@ -472,6 +708,20 @@ void GStreamerVideo::setVolume(float volume)
 }
 
 
+void GStreamerVideo::setVisible(bool visible)
+{
+    visible_ = visible;
+}
+
+
+// The size the video is shown at, in screen pixels
+void GStreamerVideo::setTargetSize(int width, int height)
+{
+    targetWidth_  = width;
+    targetHeight_ = height;
+}
+
+
 void GStreamerVideo::skipForward( )
 {
 
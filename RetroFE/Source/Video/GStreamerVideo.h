@@ -21,6 +21,7 @@ extern "C"
 {
 #include <gst/gst.h>
 #include <gst/app/gstappsink.h>
+#include <gst/video/video.h>
 }
 
 
@@ -31,6 +32,8 @@ public:
     ~GStreamerVideo();
     bool initialize();
     bool play(std::string file);
+    bool preroll(std::string file);
+    bool isPrerolled(std::string file);
     bool stop();
     bool deInitialize();
     SDL_Texture *getTexture() const;
@@ -40,8 +43,13 @@ public:
     void freeElements();
     int getHeight();
     int getWidth();
+    int getTextureHeight();
+    int getTextureWidth();
     bool isPlaying();
     void setVolume(float volume);
+    void setVisible(bool visible);
+    void setTargetSize(int width, int height);
+    int getMonitor();
     void skipForward( );
     void skipBackward( );
     void skipForwardp( );
@@ -53,20 +61,41 @@ public:
     bool isPaused( );
 
 private:
-    static void processNewBuffer (GstElement *fakesink, GstBuffer *buf, GstPad *pad, gpointer data);
+    static GstPadProbeReturn countFrame(GstPad *pad, GstPadProbeInfo *info, gpointer data);
     static gboolean busCallback(GstBus *bus, GstMessage *msg, gpointer data);
+    bool load(std::string file, GstState state);
+    bool readVideoInfo(GstCaps *caps);
+    void uploadFrame(GstBuffer *buffer);
+    void updateScale();
+
+    // The pipeline scales to the shown size in steps of 1/SCALE_STEPS of
+    // the source size. A new step is only applied once the shown size has
+    // kept to it for SCALE_STABLE_FRAMES updates, so a size tween does not
+    // renegotiate the caps on its way through every step.
+    static const int SCALE_STEPS = 8;
+    static const int SCALE_STABLE_FRAMES = 15;
 
     GstElement *playbin_;
     GstElement *videoBin_;
     GstElement *videoSink_;
     GstElement *videoConvert_;
+    GstElement *videoScale_;
     GstCaps *videoConvertCaps_;
     GstBus *videoBus_;
     SDL_Texture* texture_;
     gint height_;
     gint width_;
-    GstBuffer *videoBuffer_;
-    bool frameReady_;
+    gint sourceHeight_;
+    gint sourceWidth_;
+    int targetWidth_;
+    int targetHeight_;
+    int scaleStepX_;
+    int scaleStepY_;
+    int pendingStepX_;
+    int pendingStepY_;
+    int stableFrames_;
+    GstVideoInfo videoInfo_;
+    GstCaps *videoCaps_;
     bool isPlaying_;
     static bool initialized_;
     int playCount_;
@@ -76,4 +105,13 @@ private:
     double currentVolume_;
     int monitor_;
     bool paused_;
+    bool visible_;
+    Uint64 uploadTime_;
+    unsigned int uploadCount_;
+    SDL_atomic_t decodedCount_;
+    Uint64 playStart_;
+    bool awaitingFrame_;
+    bool reused_;
+    bool prerolled_;
+    bool fromPreroll_;
 };
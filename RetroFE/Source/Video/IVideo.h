@@ -31,7 +31,11 @@ public:
     virtual void draw() = 0;
     virtual int getHeight() = 0;
     virtual int getWidth() = 0;
+    virtual int getTextureHeight() = 0;
+    virtual int getTextureWidth() = 0;
     virtual void setVolume(float volume) = 0;
+    virtual void setVisible(bool visible) = 0;
+    virtual void setTargetSize(int width, int height) = 0;
     virtual void skipForward( ) = 0;
     virtual void skipBackward( ) = 0;
     virtual void skipForwardp( ) = 0;
@@ -22,21 +22,36 @@
 bool VideoFactory::enabled_ = true;
 int VideoFactory::numLoops_ = 0;
 IVideo *VideoFactory::instance_ = NULL;
+int VideoFactory::poolSize_ = 2;
+std::vector<std::vector<IVideo *> > VideoFactory::pool_;
+int VideoFactory::prerollSize_ = 2;
+std::list<VideoFactory::Prerolled> VideoFactory::prerolled_;
 
 
-IVideo *VideoFactory::createVideo( int monitor, bool isTypeVideo, int numLoops )
+IVideo *VideoFactory::createVideo( int monitor, bool isTypeVideo, int numLoops, std::string file )
 {
     IVideo *instance = NULL;
-    if ( enabled_ && (!isTypeVideo || !instance_) )
+
+    // Reuse the pipeline prerolled with this file, or else a stopped one,
+    // rather than building a new one
+    if ( enabled_ && file != "" )
+        instance = takePrerolled( monitor, file );
+    if ( enabled_ && !instance && !isTypeVideo )
+        instance = takeVideo( monitor );
+
+    if ( enabled_ && !instance && (!isTypeVideo || !instance_) )
     {
         instance = new GStreamerVideo( monitor );
         instance->initialize();
         if ( isTypeVideo )
             instance_ = instance;
     }
-    if ( isTypeVideo )
+    if ( isTypeVideo && !instance )
         instance = instance_;
 
+    if ( !instance )
+        return NULL;
+
     if (numLoops > 0 )
         ((GStreamerVideo *)(instance))->setNumLoops(numLoops);
     else
@@ -58,7 +73,166 @@ void VideoFactory::setNumLoops(int numLoops)
 }
 
 
+void VideoFactory::setPoolSize( int poolSize )
+{
+    poolSize_ = poolSize;
+}
+
+
+void VideoFactory::setPrerollSize( int prerollSize )
+{
+    prerollSize_ = prerollSize;
+}
+
+
+bool VideoFactory::isPrerollEnabled( )
+{
+    return enabled_ && prerollSize_ > 0;
+}
+
+
+// Get a file ready to play on a pipeline of its own. Every component that
+// asks, on whichever monitor, keeps up to prerollSize_ videos prerolled, so
+// several video components on a layout do not push out each other's; the
+// least recently requested ones of the owner are stopped.
+void VideoFactory::preroll( int monitor, std::string file, const void *owner )
+{
+    if ( !isPrerollEnabled( ) || file == "" )
+        return;
+
+    Prerolled entry;
+    entry.owner = owner;
+    entry.video = takePrerolled( monitor, file );
+    if ( !entry.video )
+    {
+        GStreamerVideo *video = (GStreamerVideo *)takeVideo( monitor );
+        if ( !video )
+        {
+            video = new GStreamerVideo( monitor );
+            video->initialize( );
+        }
+        if ( !video->preroll( file ) )
+        {
+            release( video );
+            return;
+        }
+        entry.video = video;
+    }
+    prerolled_.push_front( entry );
+
+    int count = 0;
+    std::list<Prerolled>::iterator it = prerolled_.begin( );
+    while ( it != prerolled_.end( ) )
+    {
+        if ( it->owner == owner && ++count > prerollSize_ )
+        {
+            release( it->video );
+            it = prerolled_.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+
+// Stop the videos a component had prerolled, when it goes away
+void VideoFactory::releasePrerolls( const void *owner )
+{
+    std::list<Prerolled>::iterator it = prerolled_.begin( );
+    while ( it != prerolled_.end( ) )
+    {
+        if ( it->owner == owner )
+        {
+            release( it->video );
+            it = prerolled_.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+
+IVideo *VideoFactory::takePrerolled( int monitor, std::string file )
+{
+    for ( std::list<Prerolled>::iterator it = prerolled_.begin( ); it != prerolled_.end( ); ++it )
+    {
+        GStreamerVideo *video = (GStreamerVideo *)(it->video);
+        if ( video->getMonitor( ) == monitor && video->isPrerolled( file ) )
+        {
+            IVideo *instance = it->video;
+            prerolled_.erase( it );
+            return instance;
+        }
+    }
+    return NULL;
+}
+
+
+IVideo *VideoFactory::takeVideo( int monitor )
+{
+    IVideo *instance = NULL;
+    if ( monitor >= 0 && monitor < (int)pool_.size( ) && !pool_[monitor].empty( ) )
+    {
+        instance = pool_[monitor].back( );
+        pool_[monitor].pop_back( );
+    }
+    return instance;
+}
+
+
 bool VideoFactory::canDelete( IVideo *instance )
 {
     return ( instance != instance_ );
 }
+
+
+// Stop a video that is no longer shown. Up to poolSize_ stopped videos are
+// kept for each monitor, to be handed out again by createVideo.
+void VideoFactory::release( IVideo *instance )
+{
+    if ( !instance )
+        return;
+
+    instance->stop( );
+    if ( !canDelete( instance ) )
+        return;
+
+    int monitor = ((GStreamerVideo *)(instance))->getMonitor( );
+    if ( monitor >= 0 && poolSize_ > 0 )
+    {
+        if ( monitor >= (int)pool_.size( ) )
+            pool_.resize( monitor + 1 );
+        if ( (int)pool_[monitor].size( ) < poolSize_ )
+        {
+            pool_[monitor].push_back( instance );
+            return;
+        }
+    }
+
+    delete instance;
+}
+
+
+// Take down the pooled and prerolled pipelines, which hold on to their
+// decoders and sinks
+void VideoFactory::flush( )
+{
+    for ( std::list<Prerolled>::iterator it = prerolled_.begin( ); it != prerolled_.end( ); ++it )
+    {
+        delete it->video;
+    }
+    prerolled_.clear( );
+
+    for ( unsigned int i = 0; i < pool_.size( ); ++i )
+    {
+        for ( unsigned int j = 0; j < pool_[i].size( ); ++j )
+        {
+            delete pool_[i][j];
+        }
+    }
+    pool_.clear( );
+}
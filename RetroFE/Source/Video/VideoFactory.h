@@ -15,18 +15,42 @@
  */
 #pragma once
 
+#include <string>
+#include <vector>
+#include <list>
+
 class IVideo;
 
 class VideoFactory
 {
 public:
-    static IVideo *createVideo( int monitor, bool isTypeVideo, int numLoops = -1 );
+    static IVideo *createVideo( int monitor, bool isTypeVideo, int numLoops = -1, std::string file = "" );
     static void    setEnabled(bool enabled);
     static void    setNumLoops(int numLoops);
+    static void    setPoolSize( int poolSize );
+    static void    setPrerollSize( int prerollSize );
+    static bool    isPrerollEnabled( );
+    static void    preroll( int monitor, std::string file, const void *owner );
+    static void    releasePrerolls( const void *owner );
     static bool    canDelete( IVideo *instance );
+    static void    release( IVideo *instance );
+    static void    flush( );
 
 private:
     static bool    enabled_;
     static int     numLoops_;
     static IVideo *instance_;
+    static IVideo *takePrerolled( int monitor, std::string file );
+    static IVideo *takeVideo( int monitor );
+
+    static int     poolSize_;
+    static std::vector<std::vector<IVideo *> > pool_;   // stopped videos per monitor
+    struct Prerolled
+    {
+        IVideo     *video;
+        const void *owner;                              // component that asked for it
+    };
+
+    static int     prerollSize_;
+    static std::list<Prerolled> prerolled_;             // most recently requested first
 };